@@ -121,14 +121,16 @@ void BaseCanvas::beginPolygon()
 {
 	painter.setPen(linePen);
 	polygon = QPainterPath();
+	subpathClosed = false;
 }
 
 void BaseCanvas::addPoint(const Geom::Point &point)
 {
-	if (polygon.elementCount() == 0)
+	if (polygon.elementCount() == 0 || subpathClosed)
 		polygon.moveTo(toQPoint(point));
 	else
 		polygon.lineTo(toQPoint(point));
+	subpathClosed = false;
 }
 
 void BaseCanvas::addBezier(const Geom::Point &control0,
@@ -140,10 +142,17 @@ void BaseCanvas::addBezier(const Geom::Point &control0,
 	    toQPoint(endPoint));
 }
 
+void BaseCanvas::closeSubpath()
+{
+	polygon.closeSubpath();
+	subpathClosed = true;
+}
+
 void BaseCanvas::endPolygon()
 {
 	painter.drawPath(polygon);
 	polygon = QPainterPath();
+	subpathClosed = false;
 }
 
 Geom::Rect BaseCanvas::getClipRect() const
@@ -174,6 +183,7 @@ void BaseCanvas::setClipPolygon()
 	painter.setClipping(true);
 	painter.setClipPath(polygon);
 	polygon = QPainterPath();
+	subpathClosed = false;
 }
 
 void BaseCanvas::setFont(const Gfx::Font &newFont)
@@ -44,6 +44,7 @@ public:
 	void addBezier(const Geom::Point &control0,
 	    const Geom::Point &control1,
 	    const Geom::Point &endPoint) override;
+	void closeSubpath() override;
 	void endPolygon() override;
 	void rectangle(const Geom::Rect &rect) override;
 	void circle(const Geom::Circle &circle) override;
@@ -70,6 +71,7 @@ protected:
 	QPainter painter;
 	QFont font;
 	QPainterPath polygon;
+	bool subpathClosed{};
 	QPen linePen;
 	QPen textPen;
 	QBrush brush;
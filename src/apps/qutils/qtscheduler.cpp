@@ -7,14 +7,51 @@ using namespace std::chrono;
 void QtScheduler::schedule(const GUI::Scheduler::Task &task,
     steady_clock::time_point time)
 {
-	auto actTime = steady_clock::now();
-	auto duration = time - actTime;
-	int msecs = 0;
-	if (time > actTime)
-		msecs = duration_cast<milliseconds>(duration).count();
-	QTimer::singleShot(msecs,
+	QTimer::singleShot(delay(time),
 	    [=]()
 	    {
 		    task();
 	    });
 }
+
+void QtScheduler::schedule(const GUI::Scheduler::Task &task,
+    steady_clock::time_point time,
+    Priority,
+    const void *key)
+{
+	if (!key) {
+		schedule(task, time);
+		return;
+	}
+
+	auto it = keyed->find(key);
+	if (it != keyed->end()) {
+		it->second.task = task;
+		if (it->second.time <= time) return;
+	}
+
+	auto timer = ++timers;
+	(*keyed)[key] = Keyed{task, time, timer};
+
+	// a timer superseded by an earlier one finds its task gone
+	QTimer::singleShot(delay(time),
+	    [tasks = std::weak_ptr<KeyedTasks>(keyed), key, timer]()
+	    {
+		    auto keyed = tasks.lock();
+		    if (!keyed) return;
+		    auto it = keyed->find(key);
+		    if (it == keyed->end() || it->second.timer != timer)
+			    return;
+		    auto task = std::move(it->second.task);
+		    keyed->erase(it);
+		    task();
+	    });
+}
+
+int QtScheduler::delay(TimePoint time)
+{
+	auto actTime = steady_clock::now();
+	if (time <= actTime) return 0;
+	return static_cast<int>(
+	    duration_cast<milliseconds>(time - actTime).count());
+}
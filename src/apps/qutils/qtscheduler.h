@@ -1,6 +1,10 @@
 #ifndef QTSCHEDULER_H
 #define QTSCHEDULER_H
 
+#include <cstdint>
+#include <memory>
+#include <unordered_map>
+
 #include "base/gui/scheduler.h"
 
 class QtScheduler : public GUI::Scheduler
@@ -10,6 +14,28 @@ public:
 
 	void schedule(const GUI::Scheduler::Task &task,
 	    std::chrono::steady_clock::time_point time) override;
+
+	/** Replaces the pending task of the key, running it at the earlier
+	 *  of the two times. Priorities are not supported. */
+	void schedule(const GUI::Scheduler::Task &task,
+	    std::chrono::steady_clock::time_point time,
+	    Priority,
+	    const void *key = nullptr) override;
+
+private:
+	struct Keyed
+	{
+		Task task;
+		TimePoint time;
+		uint64_t timer;
+	};
+
+	typedef std::unordered_map<const void *, Keyed> KeyedTasks;
+
+	std::shared_ptr<KeyedTasks> keyed{std::make_shared<KeyedTasks>()};
+	uint64_t timers{};
+
+	static int delay(TimePoint time);
 };
 
 #endif
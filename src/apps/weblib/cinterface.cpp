@@ -50,6 +50,11 @@ void vizzu_wheel(double delta) { Interface::instance.wheel(delta); }
 
 void vizzu_poll() { Interface::instance.poll(); }
 
+double vizzu_nextDeadline()
+{
+	return Interface::instance.nextDeadline();
+}
+
 void vizzu_update(double width, double height, int renderControl)
 {
 	Interface::instance.update(width,
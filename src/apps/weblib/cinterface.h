@@ -10,6 +10,7 @@ extern "C" {
 
 extern void vizzu_init();
 extern void vizzu_poll();
+extern double vizzu_nextDeadline();
 extern void vizzu_pointerDown(int pointerId, double x, double y);
 extern void vizzu_pointerUp(int pointerId, double x, double y);
 extern void vizzu_pointerMove(int pointerId, double x, double y);
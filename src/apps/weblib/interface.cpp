@@ -1,5 +1,6 @@
 #include "interface.h"
 
+#include <algorithm>
 #include <span>
 
 #include "base/io/log.h"
@@ -19,6 +20,7 @@ Interface::Interface() : versionStr(std::string(Main::version))
 	needsUpdate = false;
 	logging = false;
 	eventParam = nullptr;
+	activeCanvas = nullptr;
 }
 
 const char *Interface::version() const { return versionStr.c_str(); }
@@ -68,9 +70,9 @@ const char *Interface::getStyleValue(const char *path, bool computed)
 {
 	if (chart) {
 		static std::string res;
-		auto &styles = computed
-		                 ? chart->getComputedStyles()
-		                 : chart->getStyles();
+		auto styles = computed
+		                ? chart->getComputedStyles()
+		                : chart->getStyles();
 		res = Styles::Sheet::getParam(styles, path);
 		return res.c_str();
 	}
@@ -81,7 +83,7 @@ const char *Interface::getStyleValue(const char *path, bool computed)
 void Interface::setStyleValue(const char *path, const char *value)
 {
 	if (chart) {
-		chart->getStylesheet().setParams(path, value);
+		chart->setStyleParams(path, value);
 	}
 	else
 		throw std::logic_error("No chart exists");
@@ -179,6 +181,8 @@ Util::EventDispatcher::handler_id Interface::addEventListener(const char *event)
 	    {
 		    eventParam = &params;
 		    auto jsonStrIn = params.toJsonString();
+		    // handlers may draw, so the recorded commands go first
+		    if (activeCanvas) activeCanvas->flush();
 		    event_invoked(params.handler, jsonStrIn.c_str());
 		    eventParam = nullptr;
 	    });
@@ -340,7 +344,17 @@ void Interface::init()
 
 void Interface::poll()
 {
-	if (taskQueue) taskQueue->poll();
+	if (taskQueue) taskQueue->poll(std::chrono::milliseconds(8));
+}
+
+double Interface::nextDeadline() const
+{
+	if (!taskQueue) return -1;
+	auto deadline = taskQueue->nextDeadline();
+	if (!deadline) return -1;
+	auto wait = *deadline - std::chrono::steady_clock::now();
+	return std::max(0.0,
+	    std::chrono::duration<double, std::milli>(wait).count());
 }
 
 void Interface::update(double width,
@@ -358,12 +372,25 @@ void Interface::update(double width,
 
 	if ((renderControl == allow && renderNeeded)
 	    || renderControl == force) {
+		auto &quality = chart->getQuality();
+		quality.beginFrame(chart->getAnimControl().isRunning());
+
 		Vizzu::Main::JScriptCanvas canvas;
-		canvas.frameBegin();
-		widget->onUpdateSize(canvas, size);
-		widget->onDraw(canvas);
-		canvas.frameEnd();
+		activeCanvas = &canvas;
+		try {
+			canvas.frameBegin();
+			widget->onUpdateSize(canvas, size);
+			widget->onDraw(canvas);
+			canvas.frameEnd();
+		}
+		catch (...) {
+			activeCanvas = nullptr;
+			throw;
+		}
+		activeCanvas = nullptr;
 		needsUpdate = false;
+
+		quality.endFrame(std::chrono::steady_clock::now() - now);
 	}
 }
 
@@ -10,6 +10,11 @@
 namespace Vizzu
 {
 
+namespace Main
+{
+class JScriptCanvas;
+}
+
 class Interface
 {
 public:
@@ -30,6 +35,8 @@ public:
 	void
 	update(double width, double height, RenderControl renderControl);
 	void poll();
+	/** Milliseconds until the next scheduled task, -1 if none. */
+	double nextDeadline() const;
 
 	void *storeAnim();
 	void restoreAnim(void *anim);
@@ -93,6 +100,7 @@ private:
 	std::shared_ptr<Vizzu::Chart> chart;
 	ObjectRegistry objects;
 	Util::EventDispatcher::Params *eventParam;
+	Main::JScriptCanvas *activeCanvas;
 	bool needsUpdate;
 	bool logging;
 	void log(const char *str);
@@ -14,9 +14,27 @@ mergeInto(LibraryManager.library, {
 	canvas_frameBegin: function() {
 		Module.render.frameBegin();
 	},
+	canvas_repaintArea: function(x, y, width, height) {
+		return Module.render.repaintArea(x, y, width, height);
+	},
 	canvas_frameEnd: function() {
 		Module.render.frameEnd();
 	},
+	canvas_textBoundaries: function(font, texts, count, sizes) {
+		var dc = Module.render.dc();
+		dc.save();
+		font = UTF8ToString(font);
+		if (font) dc.font = font;
+		var metrics = dc.measureText('Op');
+		var height = metrics.actualBoundingBoxAscent
+		           + metrics.actualBoundingBoxDescent;
+		for (var i = 0; i < count; i++) {
+			var text = UTF8ToString(getValue(texts + i * 4, '*'));
+			setValue(sizes + i * 16, dc.measureText(text).width, 'double');
+			setValue(sizes + i * 16 + 8, height, 'double');
+		}
+		dc.restore();
+	},
 	canvas_setClipRect: function(x, y, sizex, sizey) {
 		var dc = Module.render.dc();
 		dc.beginPath();
@@ -89,6 +107,11 @@ mergeInto(LibraryManager.library, {
 		var dc = Module.render.dc();
 		dc.bezierCurveTo(c0x, c0y, c1x, c1y, x, y);
 	},
+	canvas_closeSubpath: function() {
+		var dc = Module.render.dc();
+		dc.closePath();
+		Module.render.endPolygonNotification();
+	},
 	canvas_endPolygon: function() {
 		var dc = Module.render.dc();
 		dc.closePath();
@@ -121,13 +144,17 @@ mergeInto(LibraryManager.library, {
 		if (Module.render.noneZeroLineWidth())
 			dc.stroke();
 	},
-	canvas_textBoundary: function(text, sizeX, sizeY) {
+	canvas_textBoundary: function(font, text, sizeX, sizeY) {
 		var dc = Module.render.dc();
+		dc.save();
+		font = UTF8ToString(font);
+		if (font) dc.font = font;
 		var metrics = dc.measureText(UTF8ToString(text));
 		var width = metrics.width;
 		metrics = dc.measureText('Op');
 		var height = metrics.actualBoundingBoxAscent
 		           + metrics.actualBoundingBoxDescent;
+		dc.restore();
 		setValue(sizeX, width, 'double');
 		setValue(sizeY, height, 'double');
 	},
@@ -142,13 +169,12 @@ mergeInto(LibraryManager.library, {
 	canvas_setBrushGradient: function(x1, y1, x2, y2, stopsCount, stops) {
 		var dc = Module.render.dc();
 		var grd = dc.createLinearGradient(x1, y1, x2, y2);
-		for(var i = 0; i < stopsCount * 40; i += 40) {
-			grd.addColorStop(
-				getValue(stops + i, "double"), "rgba(" +
-				getValue(stops + i + 8, "double") * 255 + "," +
-				getValue(stops + i + 16, "double") * 255 + "," +
-				getValue(stops + i + 24, "double") * 255 + "," +
-				getValue(stops + i + 32, "double") + ")"
+		for(var i = 0; i < stopsCount * 5; i += 5) {
+			grd.addColorStop(stops[i], "rgba(" +
+				stops[i + 1] * 255 + "," +
+				stops[i + 2] * 255 + "," +
+				stops[i + 3] * 255 + "," +
+				stops[i + 4] + ")"
 			);
 		}
 		dc.fillStyle = grd;
@@ -167,6 +193,60 @@ mergeInto(LibraryManager.library, {
 		var dc = Module.render.dc();
 		dc.restore();
 	},
+	// Replays a Gfx::DisplayList: opcodes followed by their arguments,
+	// strings referenced by their index in the string table.
+	canvas_replay__deps: ['canvas_setClipRect', 'canvas_setClipCircle',
+		'canvas_setClipPolygon', 'canvas_setBrushColor',
+		'canvas_setLineColor', 'canvas_setLineWidth', 'canvas_setFont',
+		'canvas_beginDropShadow', 'canvas_setDropShadowBlur',
+		'canvas_setDropShadowColor', 'canvas_setDropShadowOffset',
+		'canvas_endDropShadow', 'canvas_beginPolygon', 'canvas_addPoint',
+		'canvas_addBezier', 'canvas_endPolygon', 'canvas_rectangle',
+		'canvas_circle', 'canvas_line', 'canvas_text',
+		'canvas_setBrushGradient', 'canvas_transform', 'canvas_save',
+		'canvas_restore', 'canvas_closeSubpath'],
+	canvas_replay: function(commands, count, strings, stringCount) {
+		var c = HEAPF32.subarray(commands >> 2, (commands >> 2) + count);
+		var str = function(index) {
+			return getValue(strings + index * 4, '*');
+		};
+		var i = 0;
+		while (i < count) {
+			switch (c[i++]) {
+			case 0: _canvas_setClipRect(c[i], c[i + 1], c[i + 2], c[i + 3]); i += 4; break;
+			case 1: _canvas_setClipCircle(c[i], c[i + 1], c[i + 2]); i += 3; break;
+			case 2: _canvas_setClipPolygon(); break;
+			case 3: _canvas_setBrushColor(c[i], c[i + 1], c[i + 2], c[i + 3]); i += 4; break;
+			case 4: _canvas_setLineColor(c[i], c[i + 1], c[i + 2], c[i + 3]); i += 4; break;
+			case 5: _canvas_setLineWidth(c[i]); i += 1; break;
+			case 6: _canvas_setFont(str(c[i])); i += 1; break;
+			case 7: _canvas_beginDropShadow(); break;
+			case 8: _canvas_setDropShadowBlur(c[i]); i += 1; break;
+			case 9: _canvas_setDropShadowColor(c[i], c[i + 1], c[i + 2], c[i + 3]); i += 4; break;
+			case 10: _canvas_setDropShadowOffset(c[i], c[i + 1]); i += 2; break;
+			case 11: _canvas_endDropShadow(); break;
+			case 12: _canvas_beginPolygon(); break;
+			case 13: _canvas_addPoint(c[i], c[i + 1]); i += 2; break;
+			case 14: _canvas_addBezier(c[i], c[i + 1], c[i + 2], c[i + 3], c[i + 4], c[i + 5]); i += 6; break;
+			case 15: _canvas_endPolygon(); break;
+			case 16: _canvas_rectangle(c[i], c[i + 1], c[i + 2], c[i + 3]); i += 4; break;
+			case 17: _canvas_circle(c[i], c[i + 1], c[i + 2]); i += 3; break;
+			case 18: _canvas_line(c[i], c[i + 1], c[i + 2], c[i + 3]); i += 4; break;
+			case 19: _canvas_text(c[i], c[i + 1], c[i + 2], c[i + 3], str(c[i + 4])); i += 5; break;
+			case 20:
+				var stops = c[i + 4];
+				_canvas_setBrushGradient(c[i], c[i + 1], c[i + 2], c[i + 3], stops,
+					c.subarray(i + 5, i + 5 + stops * 5));
+				i += 5 + stops * 5;
+				break;
+			case 21: _canvas_transform(c[i], c[i + 1], c[i + 2], c[i + 3], c[i + 4], c[i + 5]); i += 6; break;
+			case 22: _canvas_save(); break;
+			case 23: _canvas_restore(); break;
+			case 24: _canvas_closeSubpath(); break;
+			default: throw new Error('invalid display list opcode');
+			}
+		}
+	},
 	event_invoked: function(handlerId, param) {
 		Module.events.invoke(handlerId, param);
 	}
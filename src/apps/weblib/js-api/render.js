@@ -13,6 +13,7 @@ export default class Render {
     this.log = log;
     this.updateCanvasSize();
     this.prevUpdateHash = "";
+    this.frameKept = false;
   }
 
   canvas() {
@@ -45,6 +46,18 @@ export default class Render {
       this.mainCanvas.height + 1
     );
     this.context.drawImage(this.offscreenCanvas, 0, 0);
+    this.frameKept = true;
+  }
+
+  repaintArea(x, y, width, height) {
+    if (!this.frameKept) return false;
+    let dc = this.offscreenContext;
+    dc.save();
+    dc.setTransform(1, 0, 0, 1, 0, 0);
+    dc.drawImage(this.mainCanvas, 0, 0);
+    dc.restore();
+    dc.clearRect(x, y, width, height);
+    return true;
   }
 
   lineWidthNotification(width) {
@@ -77,6 +90,7 @@ export default class Render {
       this.offscreenCanvas.height = this.cssHeight * this.scaleFactor;
       this.offscreenContext.translate(0.5, 0.5);
       this.offscreenContext.scale(this.scaleFactor, this.scaleFactor);
+      this.frameKept = false;
     }
     this.prevUpdateHash = hash;
   }
@@ -16,12 +16,16 @@ public:
 
 	Duration getDuration() const { return duration; };
 
+	/** Whether the last setPosition call changed anything. */
+	bool isDirty() const { return dirty; }
+
 	virtual std::shared_ptr<void> data() const {
 	    return nullptr;
 	};
 
 protected:
 	Duration duration;
+	bool dirty{true};
 
 	bool isEmpty() const { return duration == Duration(0.0); }
 };
@@ -1,14 +1,95 @@
 #include "easing.h"
 
+#include <cmath>
+#include <mutex>
+
 #include "base/anim/easingfunc.h"
-#include "base/anim/easinggradient.h"
 #include "base/conv/parse.h"
+#include "base/geom/bezier.h"
+#include "base/geom/point.h"
 #include "base/text/funcstring.h"
 #include "base/text/smartstring.h"
 
 using namespace Anim;
 using namespace Conv;
 
+namespace
+{
+
+Easing::Function bezier(const Geom::Point &p1, const Geom::Point &p2)
+{
+	return [curve = Geom::CubicBezier<Geom::Point>(Geom::Point(0, 0),
+	            p1,
+	            p2,
+	            Geom::Point(1, 1))](double x)
+	{
+		// x(t) is monotone for control points within [0, 1]
+		double low = 0.0;
+		double high = 1.0;
+		for (auto i = 0; i < 48; i++) {
+			auto t = (low + high) / 2;
+			(curve(t).x < x ? low : high) = t;
+		}
+		return curve((low + high) / 2).y;
+	};
+}
+
+}
+
+std::shared_ptr<const Easing::Table> Easing::Table::create(
+    const Function &func,
+    double maxError)
+{
+	auto res = std::make_shared<Table>();
+	auto &values = res->values;
+
+	for (auto size = minSize; size <= maxSize; size = size * 2 - 1) {
+		values.resize(size);
+		for (auto i = 0u; i < size; i++)
+			values[i] = func(static_cast<double>(i)
+			                 / static_cast<double>(size - 1));
+
+		auto accurate = true;
+		for (auto i = 0u; accurate && i + 1 < size; i++) {
+			auto x = (static_cast<double>(i) + 0.5)
+			       / static_cast<double>(size - 1);
+			accurate = std::abs((*res)(x) - func(x)) <= maxError;
+		}
+		if (accurate) return res;
+	}
+	return nullptr;
+}
+
+Easing::Easing(Function func, double maxError) :
+    func(std::move(func)),
+    table(this->func ? Table::create(this->func, maxError) : nullptr)
+{}
+
+Easing::Easing(Pointer func, double maxError) : func(func)
+{
+	struct Entry
+	{
+		Pointer func;
+		double maxError;
+		std::shared_ptr<const Table> table;
+	};
+
+	static std::mutex mutex;
+	static std::vector<Entry> tables;
+
+	if (!func) return;
+
+	std::lock_guard lock(mutex);
+	for (const auto &entry : tables)
+		if (entry.func == func && entry.maxError == maxError) {
+			table = entry.table;
+			return;
+		}
+
+	table = Table::create(this->func, maxError);
+	tables.push_back({func, maxError, table});
+}
+
 Easing::Easing(const std::string &name)
 {
 	if (name.empty()) return;
@@ -16,31 +97,31 @@ Easing::Easing(const std::string &name)
 	auto nameCopy = name;
 	Text::SmartString::trim(nameCopy);
 
-	if (nameCopy == "none") { func = &Easing::none; }
+	if (nameCopy == "none") { *this = Easing(&Easing::none); }
 	else if (nameCopy == "linear") {
-		func = &Easing::linear;
+		*this = Easing(&Easing::linear);
 	}
 	else if (nameCopy == "step-start") {
-		func = &Easing::start;
+		*this = Easing(&Easing::start);
 	}
 	else if (nameCopy == "step-end") {
-		func = &Easing::end;
+		*this = Easing(&Easing::end);
 	}
 	else if (nameCopy == "ease") {
-		func = EasingGradient::Bezier(Geom::Point(0.25, 0.1),
-		    Geom::Point(0.25, 1));
+		*this = Easing(
+		    bezier(Geom::Point(0.25, 0.1), Geom::Point(0.25, 1)));
 	}
 	else if (nameCopy == "ease-in") {
-		func = EasingGradient::Bezier(Geom::Point(0.42, 0),
-		    Geom::Point(1, 1));
+		*this =
+		    Easing(bezier(Geom::Point(0.42, 0), Geom::Point(1, 1)));
 	}
 	else if (nameCopy == "ease-out") {
-		func = EasingGradient::Bezier(Geom::Point(0, 0),
-		    Geom::Point(0.58, 1));
+		*this =
+		    Easing(bezier(Geom::Point(0, 0), Geom::Point(0.58, 1)));
 	}
 	else if (nameCopy == "ease-in-out") {
-		func = EasingGradient::Bezier(Geom::Point(0.42, 0),
-		    Geom::Point(0.58, 1));
+		*this = Easing(
+		    bezier(Geom::Point(0.42, 0), Geom::Point(0.58, 1)));
 	}
 	else if (Text::FuncString f(nameCopy, false);
 	         f.getName() == "cubic-bezier") {
@@ -53,8 +134,34 @@ Easing::Easing(const std::string &name)
 		Geom::Point p2(parse<double>(f.getParams().at(2)),
 		    parse<double>(f.getParams().at(3)));
 
-		func = EasingGradient::Bezier(p1, p2);
+		if (p1.x < 0 || p1.x > 1 || p2.x < 0 || p2.x > 1)
+			throw std::logic_error(
+			    "cubic-bezier x values must be within [0, 1]");
+
+		*this = Easing(bezier(p1, p2));
 	}
 	else
 		throw std::logic_error("invalid easing value");
+
+	this->name = nameCopy;
+}
+
+bool Easing::operator==(const Easing &other) const
+{
+	if (!name.empty() || !other.name.empty()) return name == other.name;
+
+	const auto *pointer = func.target<Pointer>();
+	const auto *otherPointer = other.func.target<Pointer>();
+	if (pointer && otherPointer) return *pointer == *otherPointer;
+
+	return !func && !other.func;
+}
+
+void Easing::operator()(std::span<double> factors) const
+{
+	if (table)
+		for (auto &x : factors)
+			x = x < 0 ? 0 : x > 1 ? 1 : (*table)(x);
+	else
+		for (auto &x : factors) x = (*this)(x);
 }
@@ -1,8 +1,12 @@
 #ifndef ANIM_EASING
 #define ANIM_EASING
 
+#include <algorithm>
 #include <functional>
+#include <memory>
+#include <span>
 #include <string>
+#include <vector>
 
 namespace Anim
 {
@@ -11,6 +15,9 @@ class Easing
 {
 public:
 	typedef std::function<double(double)> Function;
+	typedef double (*Pointer)(double);
+
+	static constexpr double defaultMaxError = 1e-4;
 
 	static double none(double) { return 0; }
 	static double start(double) { return 1; }
@@ -18,19 +25,64 @@ public:
 	static double linear(double x) { return x; }
 
 	Easing() {}
-	Easing(Function func) : func(std::move(func)) {}
+	Easing(Function func, double maxError = defaultMaxError);
+	Easing(Pointer func, double maxError = defaultMaxError);
 	explicit Easing(const std::string &name);
 
 	double operator()(double x) const
 	{
 		if (x < 0) return 0;
 		if (x > 1) return 1;
+		if (table) return (*table)(x);
 		if (func) return func(x);
 		return x;
 	}
 
+	void operator()(std::span<double> factors) const;
+
+	bool isTabulated() const { return static_cast<bool>(table); }
+
+	/**
+	 * Conservative equality: easings parsed from the same string or
+	 * built from the same function pointer compare equal, arbitrary
+	 * function objects only to empty ones.
+	 */
+	bool operator==(const Easing &other) const;
+
 private:
-	std::function<double(double)> func;
+	/**
+	 * Easing curve sampled at evenly spaced points and linearly
+	 * interpolated in between. The sample count is doubled until the
+	 * interpolation error at the segment midpoints gets below the
+	 * requested limit; curves which do not get there (e.g. steps) are
+	 * not tabulated.
+	 */
+	class Table
+	{
+	public:
+		static constexpr size_t minSize = 65;
+		static constexpr size_t maxSize = 4097;
+
+		static std::shared_ptr<const Table> create(const Function &func,
+		    double maxError);
+
+		double operator()(double x) const
+		{
+			auto position = x * static_cast<double>(values.size() - 1);
+			auto index = std::min(static_cast<size_t>(position),
+			    values.size() - 2);
+			auto factor = position - static_cast<double>(index);
+			return values[index]
+			     + (values[index + 1] - values[index]) * factor;
+		}
+
+	private:
+		std::vector<double> values;
+	};
+
+	Function func;
+	std::shared_ptr<const Table> table;
+	std::string name;
 };
 
 }
@@ -49,9 +49,13 @@ const Options &Group::addElement(std::unique_ptr<IElement> element,
 
 void Group::setPosition(Duration progress)
 {
-	for (const auto &element : elements) {
+	dirty = false;
+	for (auto &element : elements) {
 		auto factor = element.options.getFactor(progress);
+		if (factor == element.factor) continue;
+		element.factor = factor;
 		element.element->transform(factor);
+		dirty = true;
 	}
 }
 
@@ -1,6 +1,7 @@
 #ifndef ANIM_GROUP
 #define ANIM_GROUP
 
+#include <limits>
 #include <memory>
 #include <vector>
 
@@ -34,10 +35,12 @@ private:
 	{
 		Record(std::unique_ptr<IElement> element, Options options) :
 		    element(std::move(element)),
-		    options(std::move(options))
+		    options(std::move(options)),
+		    factor(std::numeric_limits<double>::quiet_NaN())
 		{}
 		std::unique_ptr<IElement> element;
 		Options options;
+		double factor;
 	};
 
 	std::vector<Record> elements;
@@ -4,8 +4,10 @@
 #include <array>
 #include <cstdint>
 #include <functional>
+#include <memory>
 #include <stdexcept>
 #include <string>
+#include <type_traits>
 
 #include "base/conv/parse.h"
 #include "base/conv/tostring.h"
@@ -49,11 +51,78 @@ public:
 	bool hasValue() const { return weight > 0.0; }
 };
 
+/**
+ * Storage of the two weighted values of an Interpolated. Trivially
+ * copyable types keep both slots inline. Other types (strings, index
+ * vectors) keep the second slot on the heap, allocated on first write
+ * and dropped once no interpolation is in progress, so single values
+ * never carry or copy a second one.
+ */
+template <typename Type,
+    bool Inline = std::is_trivially_copyable_v<Type>>
+class WeightedPair : public std::array<Weighted<Type>, 2>
+{
+public:
+	void release() {}
+};
+
+template <typename Type> class WeightedPair<Type, false>
+{
+public:
+	WeightedPair() = default;
+	WeightedPair(WeightedPair &&) noexcept = default;
+	WeightedPair &operator=(WeightedPair &&) noexcept = default;
+
+	WeightedPair(const WeightedPair &other) :
+	    first(other.first),
+	    second(other.second
+	               ? std::make_unique<Weighted<Type>>(*other.second)
+	               : nullptr)
+	{}
+
+	WeightedPair &operator=(const WeightedPair &other)
+	{
+		first = other.first;
+		if (!other.second)
+			second.reset();
+		else if (second)
+			*second = *other.second;
+		else
+			second = std::make_unique<Weighted<Type>>(*other.second);
+		return *this;
+	}
+
+	Weighted<Type> &operator[](size_t index)
+	{
+		if (index == 0) return first;
+		if (!second) second = std::make_unique<Weighted<Type>>();
+		return *second;
+	}
+
+	const Weighted<Type> &operator[](size_t index) const
+	{
+		if (index == 0) return first;
+		return second ? *second : empty();
+	}
+
+	void release() { second.reset(); }
+
+private:
+	Weighted<Type> first;
+	std::unique_ptr<Weighted<Type>> second;
+
+	static const Weighted<Type> &empty()
+	{
+		static const Weighted<Type> value;
+		return value;
+	}
+};
+
 template <typename Type> class Interpolated
 {
 public:
 	uint64_t count;
-	std::array<Weighted<Type>, 2> values;
+	WeightedPair<Type> values;
 
 	Interpolated() : count(1) {}
 	Interpolated(const Interpolated &) = default;
@@ -275,6 +344,66 @@ Interpolated<Type> interpolate(const Interpolated<Type> &op0,
 	}
 }
 
+/**
+ * Same as assigning interpolate(op0, op1, factor) to res, but reuses
+ * the storage of res: values it already holds are not copied again,
+ * only their weights are updated.
+ */
+template <typename Type>
+void interpolateInto(Interpolated<Type> &res,
+    const Interpolated<Type> &op0,
+    const Interpolated<Type> &op1,
+    double factor)
+{
+	auto set = [](Weighted<Type> &slot, const Type &value, double weight)
+	{
+		if (!(slot.value == value)) slot.value = value;
+		slot.weight = weight;
+	};
+
+	if (factor <= 0.0) {
+		set(res.values[0], op0.values[0].value, op0.values[0].weight);
+		if (op0.count == 2)
+			set(res.values[1],
+			    op0.values[1].value,
+			    op0.values[1].weight);
+		else
+			res.values.release();
+		res.count = op0.count;
+	}
+	else if (factor >= 1.0) {
+		if (op1.count != 1)
+			throw std::logic_error("Cannot move Weigthed Value");
+		set(res.values[0], Type(), 0.0);
+		set(res.values[1], op1.values[0].value, op1.values[0].weight);
+		res.count = 2;
+	}
+	else {
+		if (op0.count != 1 || op1.count != 1)
+			throw std::logic_error(
+			    "Cannot interpolate Weigthed Pairs");
+
+		if (op0.values[0].value == op1.values[0].value) {
+			set(res.values[0],
+			    op0.values[0].value,
+			    Math::interpolate(op0.values[0].weight,
+			        op1.values[0].weight,
+			        factor));
+			res.values.release();
+			res.count = 1;
+		}
+		else {
+			set(res.values[0],
+			    op0.values[0].value,
+			    op0.values[0].weight * (1.0 - factor));
+			set(res.values[1],
+			    op1.values[0].value,
+			    op1.values[0].weight * factor);
+			res.count = 2;
+		}
+	}
+}
+
 typedef Interpolated<std::string> String;
 
 }
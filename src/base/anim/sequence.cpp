@@ -7,6 +7,8 @@ Sequence::Sequence() : actual(nullptr) {}
 void Sequence::setPosition(Duration progress)
 {
 	auto start = Duration(0);
+	auto *previous = actual;
+	dirty = false;
 
 	if (progress > duration) progress = duration;
 
@@ -17,6 +19,7 @@ void Sequence::setPosition(Duration progress)
 		}
 		else {
 			actual->setPosition(progress - start);
+			dirty = actual != previous || actual->isDirty();
 			return;
 		}
 	}
@@ -0,0 +1,109 @@
+#include "spatialindex.h"
+
+#include <algorithm>
+#include <cmath>
+#include <iterator>
+
+using namespace Geom;
+
+namespace
+{
+
+bool isFinite(const std::optional<Rect> &rect)
+{
+	return rect && std::isfinite(rect->pos.x) && std::isfinite(rect->pos.y)
+	    && std::isfinite(rect->size.x) && std::isfinite(rect->size.y);
+}
+
+}
+
+SpatialIndex::SpatialIndex(
+    const std::vector<std::optional<Rect>> &boundaries) :
+    count(boundaries.size())
+{
+	std::optional<Rect> bounds;
+	auto bounded = 0u;
+	for (const auto &boundary : boundaries)
+		if (isFinite(boundary)) {
+			bounds = bounds ? bounds->boundary(*boundary)
+			                : boundary->positive();
+			bounded++;
+		}
+
+	if (bounds) {
+		extent = *bounds;
+		static constexpr size_t maxSide = 256;
+		auto side = static_cast<size_t>(
+		    std::ceil(std::sqrt(static_cast<double>(bounded))));
+		side = std::clamp<size_t>(side, 1, maxSide);
+		columns = extent.width() > 0 ? side : 1;
+		rows = extent.height() > 0 ? side : 1;
+		cells.resize(columns * rows);
+	}
+
+	for (auto i = 0u; i < boundaries.size(); i++) {
+		if (!isFinite(boundaries[i])) {
+			unbounded.push_back(i);
+			continue;
+		}
+		auto rect = boundaries[i]->positive();
+		for (auto r = row(rect.bottom()); r <= row(rect.top()); r++)
+			for (auto c = column(rect.left());
+			     c <= column(rect.right());
+			     c++)
+				cells[r * columns + c].push_back(i);
+	}
+}
+
+size_t SpatialIndex::column(double x) const
+{
+	if (extent.width() <= 0) return 0;
+	auto c = std::floor((x - extent.left()) / extent.width()
+	                    * static_cast<double>(columns));
+	return static_cast<size_t>(
+	    std::clamp(c, 0.0, static_cast<double>(columns - 1)));
+}
+
+size_t SpatialIndex::row(double y) const
+{
+	if (extent.height() <= 0) return 0;
+	auto r = std::floor((y - extent.bottom()) / extent.height()
+	                    * static_cast<double>(rows));
+	return static_cast<size_t>(
+	    std::clamp(r, 0.0, static_cast<double>(rows - 1)));
+}
+
+std::vector<size_t> SpatialIndex::find(const Point &point) const
+{
+	if (cells.empty() || !extent.contains(point)) return unbounded;
+
+	const auto &cell = cells[row(point.y) * columns + column(point.x)];
+	if (unbounded.empty()) return cell;
+
+	std::vector<size_t> res;
+	res.reserve(cell.size() + unbounded.size());
+	std::merge(cell.begin(),
+	    cell.end(),
+	    unbounded.begin(),
+	    unbounded.end(),
+	    std::back_inserter(res));
+	return res;
+}
+
+std::vector<size_t> SpatialIndex::find(const Rect &area) const
+{
+	auto rect = area.positive();
+	if (cells.empty() || !extent.intersects(rect)) return unbounded;
+
+	auto res = unbounded;
+	for (auto r = row(rect.bottom()); r <= row(rect.top()); r++)
+		for (auto c = column(rect.left()); c <= column(rect.right());
+		     c++) {
+			const auto &cell = cells[r * columns + c];
+			res.insert(res.end(), cell.begin(), cell.end());
+		}
+
+	std::sort(res.begin(), res.end());
+	res.erase(std::unique(res.begin(), res.end()), res.end());
+	return res;
+}
@@ -0,0 +1,49 @@
+#ifndef GEOM_SPATIALINDEX
+#define GEOM_SPATIALINDEX
+
+#include <cstddef>
+#include <optional>
+#include <vector>
+
+#include "point.h"
+#include "rect.h"
+
+namespace Geom
+{
+
+/**
+ * Uniform grid over the boundary rectangles of items for point and
+ * area queries. Items are identified by their position in the
+ * constructor argument; an item without (finite) boundary is a
+ * candidate for any query.
+ */
+class SpatialIndex
+{
+public:
+	SpatialIndex() = default;
+	explicit SpatialIndex(
+	    const std::vector<std::optional<Rect>> &boundaries);
+
+	/** Indices of the items possibly containing the point, ascending. */
+	std::vector<size_t> find(const Point &point) const;
+	/** Indices of the items possibly intersecting the area, ascending.
+	 */
+	std::vector<size_t> find(const Rect &area) const;
+
+	size_t size() const { return count; }
+
+private:
+	size_t count{};
+	size_t columns{};
+	size_t rows{};
+	Rect extent;
+	std::vector<std::vector<size_t>> cells;
+	std::vector<size_t> unbounded;
+
+	size_t column(double x) const;
+	size_t row(double y) const;
+};
+
+}
+
+#endif
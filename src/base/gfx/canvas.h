@@ -3,6 +3,7 @@
 
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "base/geom/affinetransform.h"
 #include "base/geom/circle.h"
@@ -18,6 +19,7 @@
 namespace Gfx
 {
 
+class DisplayList;
 struct ICanvas;
 typedef std::shared_ptr<ICanvas> ICanvasPtr;
 
@@ -26,6 +28,16 @@ struct ICanvas
 	virtual ~ICanvas() {}
 
 	virtual Geom::Size textBoundary(const std::string &string) = 0;
+	/** Measures several strings with the actual font at once. */
+	virtual std::vector<Geom::Size> textBoundaries(
+	    const std::vector<std::string> &strings)
+	{
+		std::vector<Geom::Size> res;
+		res.reserve(strings.size());
+		for (const auto &string : strings)
+			res.push_back(textBoundary(string));
+		return res;
+	}
 	virtual Geom::Rect getClipRect() const = 0;
 	virtual void setClipRect(const Geom::Rect &rect) = 0;
 	virtual void setClipCircle(const Geom::Circle &circle) = 0;
@@ -51,6 +63,9 @@ struct ICanvas
 	virtual void addBezier(const Geom::Point &control0,
 	    const Geom::Point &control1,
 	    const Geom::Point &endPoint) = 0;
+	/** Closes the actual polygon, the next point starts a new one
+	 *  within the same path filled by endPolygon(). */
+	virtual void closeSubpath() = 0;
 	virtual void endPolygon() = 0;
 
 	virtual void rectangle(const Geom::Rect &rect) = 0;
@@ -63,6 +78,20 @@ struct ICanvas
 	virtual void setBrushGradient(const Geom::Line &line,
 	    const ColorGradient &gradient) = 0;
 
+	/** Tells whether replay() draws display lists, without touching
+	 *  the state of the canvas. */
+	virtual bool canReplay() const { return false; }
+
+	/** Draws the recorded commands; returns false without drawing
+	 *  anything if the canvas cannot replay display lists. */
+	virtual bool replay(const DisplayList &) { return false; }
+
+	/** Restricts the frame to the area: only the area is cleared, the
+	 *  rest keeps the previous frame. Has to be called before drawing
+	 *  anything in the frame; returns false if the previous frame is
+	 *  not kept, then the whole frame has to be drawn. */
+	virtual bool repaintArea(const Geom::Rect &) { return false; }
+
 	virtual void frameBegin() = 0;
 	virtual void frameEnd() = 0;
 
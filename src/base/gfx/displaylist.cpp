@@ -0,0 +1,102 @@
+#include "displaylist.h"
+
+#include <stdexcept>
+
+using namespace Gfx;
+
+void DisplayList::add(Op op, std::initializer_list<double> args)
+{
+	commands.push_back(static_cast<float>(op));
+	append(args);
+}
+
+void DisplayList::add(Op op,
+    std::initializer_list<double> args,
+    const std::string &string)
+{
+	add(op, args);
+	commands.push_back(static_cast<float>(addString(string)));
+}
+
+void DisplayList::append(std::initializer_list<double> args)
+{
+	for (auto arg : args) commands.push_back(static_cast<float>(arg));
+}
+
+void DisplayList::append(const DisplayList &other,
+    size_t begin,
+    size_t end)
+{
+	const auto &source = other.commands;
+	commands.insert(commands.end(),
+	    source.begin() + static_cast<std::ptrdiff_t>(begin),
+	    source.begin() + static_cast<std::ptrdiff_t>(end));
+
+	auto offset = commands.size() - (end - begin);
+	for (auto pos = begin; pos < end; pos += other.commandSize(pos)) {
+		auto op = static_cast<Op>(source[pos]);
+		auto stringArg = op == Op::setFont ? 1u
+		               : op == Op::text    ? 5u
+		                                   : 0u;
+		if (stringArg == 0) continue;
+		auto &index = commands[offset + pos - begin + stringArg];
+		index = static_cast<float>(addString(
+		    other.strings[static_cast<size_t>(index)]));
+	}
+}
+
+size_t DisplayList::commandSize(size_t offset) const
+{
+	switch (static_cast<Op>(commands[offset])) {
+	case Op::setClipPolygon:
+	case Op::beginDropShadow:
+	case Op::endDropShadow:
+	case Op::beginPolygon:
+	case Op::endPolygon:
+	case Op::save:
+	case Op::restore:
+	case Op::closeSubpath: return 1;
+	case Op::setLineWidth:
+	case Op::setFont:
+	case Op::setDropShadowBlur: return 2;
+	case Op::setDropShadowOffset:
+	case Op::addPoint: return 3;
+	case Op::setClipCircle:
+	case Op::circle: return 4;
+	case Op::setClipRect:
+	case Op::setBrushColor:
+	case Op::setLineColor:
+	case Op::setDropShadowColor:
+	case Op::rectangle:
+	case Op::line: return 5;
+	case Op::text: return 6;
+	case Op::addBezier:
+	case Op::transform: return 7;
+	case Op::setBrushGradient:
+		return 6 + 5 * static_cast<size_t>(commands[offset + 5]);
+	}
+	throw std::logic_error("invalid display list command");
+}
+
+uint32_t DisplayList::addString(const std::string &string)
+{
+	auto [it, inserted] = stringIndices.try_emplace(string,
+	    static_cast<uint32_t>(strings.size()));
+	if (inserted) strings.push_back(string);
+	return it->second;
+}
+
+std::vector<const char *> DisplayList::getStringPointers() const
+{
+	std::vector<const char *> res;
+	res.reserve(strings.size());
+	for (const auto &string : strings) res.push_back(string.c_str());
+	return res;
+}
+
+void DisplayList::clear()
+{
+	commands.clear();
+	strings.clear();
+	stringIndices.clear();
+}
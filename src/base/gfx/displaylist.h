@@ -0,0 +1,84 @@
+#ifndef GFX_DISPLAYLIST
+#define GFX_DISPLAYLIST
+
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace Gfx
+{
+
+/**
+ * Flat recording of canvas commands for replaying them on the other
+ * side of a language boundary in one call. Each command is its opcode
+ * followed by its arguments, all stored as floats; strings (fonts,
+ * texts) are stored once in a string table and referenced by index.
+ */
+class DisplayList
+{
+public:
+	enum class Op : uint8_t {
+		setClipRect,
+		setClipCircle,
+		setClipPolygon,
+		setBrushColor,
+		setLineColor,
+		setLineWidth,
+		setFont,
+		beginDropShadow,
+		setDropShadowBlur,
+		setDropShadowColor,
+		setDropShadowOffset,
+		endDropShadow,
+		beginPolygon,
+		addPoint,
+		addBezier,
+		endPolygon,
+		rectangle,
+		circle,
+		line,
+		text,
+		setBrushGradient,
+		transform,
+		save,
+		restore,
+		closeSubpath
+	};
+
+	void add(Op op, std::initializer_list<double> args = {});
+	void add(Op op,
+	    std::initializer_list<double> args,
+	    const std::string &string);
+	void append(std::initializer_list<double> args);
+	/** Appends the commands of the other list between the given
+	 *  offsets, with the strings they reference. */
+	void append(const DisplayList &other, size_t begin, size_t end);
+
+	uint32_t addString(const std::string &string);
+
+	const std::vector<float> &getCommands() const { return commands; }
+	const std::vector<std::string> &getStrings() const
+	{
+		return strings;
+	}
+	std::vector<const char *> getStringPointers() const;
+
+	/** Number of floats of the command at the offset, opcode and
+	 *  arguments together. */
+	size_t commandSize(size_t offset) const;
+
+	bool empty() const { return commands.empty(); }
+	void clear();
+
+private:
+	std::vector<float> commands;
+	std::vector<std::string> strings;
+	std::unordered_map<std::string, uint32_t> stringIndices;
+};
+
+}
+
+#endif
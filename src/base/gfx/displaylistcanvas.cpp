@@ -0,0 +1,254 @@
+#include "displaylistcanvas.h"
+
+using namespace Gfx;
+
+using Op = DisplayList::Op;
+
+DisplayListCanvas::DisplayListCanvas(ICanvas *measuringCanvas) :
+    measuringCanvas(measuringCanvas)
+{}
+
+Geom::Size DisplayListCanvas::textBoundary(const std::string &text)
+{
+	if (!measuringCanvas) return {};
+
+	measuringCanvas->save();
+	if (font) measuringCanvas->setFont(*font);
+	auto res = measuringCanvas->textBoundary(text);
+	measuringCanvas->restore();
+	return res;
+}
+
+std::vector<Geom::Size> DisplayListCanvas::textBoundaries(
+    const std::vector<std::string> &texts)
+{
+	if (!measuringCanvas) return std::vector<Geom::Size>(texts.size());
+
+	measuringCanvas->save();
+	if (font) measuringCanvas->setFont(*font);
+	auto res = measuringCanvas->textBoundaries(texts);
+	measuringCanvas->restore();
+	return res;
+}
+
+Geom::Rect DisplayListCanvas::getClipRect() const
+{
+	return clipRect ? *clipRect : Geom::Rect::CenteredMax();
+}
+
+void DisplayListCanvas::setClipRect(const Geom::Rect &rect)
+{
+	if (!clipRect || *clipRect != rect) {
+		clipRect = rect;
+		displayList.add(Op::setClipRect,
+		    {rect.pos.x, rect.pos.y, rect.size.x, rect.size.y});
+	}
+}
+
+void DisplayListCanvas::setClipCircle(const Geom::Circle &circle)
+{
+	clipRect = circle.boundary();
+	displayList.add(Op::setClipCircle,
+	    {circle.center.x, circle.center.y, circle.radius});
+}
+
+void DisplayListCanvas::setClipPolygon()
+{
+	displayList.add(Op::setClipPolygon);
+}
+
+void DisplayListCanvas::setBrushColor(const Gfx::Color &color)
+{
+	if (color != brushColor) {
+		brushColor = color;
+		displayList.add(Op::setBrushColor,
+		    {color.red, color.green, color.blue, color.alpha});
+	}
+}
+
+void DisplayListCanvas::setLineColor(const Gfx::Color &color)
+{
+	if (color != lineColor) {
+		lineColor = color;
+		displayList.add(Op::setLineColor,
+		    {color.red, color.green, color.blue, color.alpha});
+	}
+}
+
+void DisplayListCanvas::setLineWidth(double width)
+{
+	if (width != lineWidth) {
+		lineWidth = width;
+		displayList.add(Op::setLineWidth, {width});
+	}
+}
+
+void DisplayListCanvas::setFont(const Gfx::Font &font)
+{
+	if (this->font != font) {
+		this->font = font;
+		displayList.add(Op::setFont, {}, font.toCSS());
+	}
+}
+
+void DisplayListCanvas::setTextColor(const Gfx::Color &color)
+{
+	setBrushColor(color);
+}
+
+void DisplayListCanvas::beginDropShadow()
+{
+	displayList.add(Op::beginDropShadow);
+}
+
+void DisplayListCanvas::setDropShadowBlur(uint64_t radius)
+{
+	displayList.add(Op::setDropShadowBlur,
+	    {static_cast<double>(radius)});
+}
+
+void DisplayListCanvas::setDropShadowColor(const Gfx::Color &color)
+{
+	displayList.add(Op::setDropShadowColor,
+	    {color.red, color.green, color.blue, color.alpha});
+}
+
+void DisplayListCanvas::setDropShadowOffset(
+    const Geom::Point &offset)
+{
+	displayList.add(Op::setDropShadowOffset, {offset.x, offset.y});
+}
+
+void DisplayListCanvas::endDropShadow()
+{
+	displayList.add(Op::endDropShadow);
+}
+
+void DisplayListCanvas::beginPolygon()
+{
+	displayList.add(Op::beginPolygon);
+}
+
+void DisplayListCanvas::addPoint(const Geom::Point &point)
+{
+	displayList.add(Op::addPoint, {point.x, point.y});
+}
+
+void DisplayListCanvas::addBezier(const Geom::Point &control0,
+    const Geom::Point &control1,
+    const Geom::Point &endPoint)
+{
+	displayList.add(Op::addBezier,
+	    {control0.x,
+	        control0.y,
+	        control1.x,
+	        control1.y,
+	        endPoint.x,
+	        endPoint.y});
+}
+
+void DisplayListCanvas::closeSubpath()
+{
+	displayList.add(Op::closeSubpath);
+}
+
+void DisplayListCanvas::endPolygon()
+{
+	displayList.add(Op::endPolygon);
+}
+
+void DisplayListCanvas::rectangle(const Geom::Rect &rect)
+{
+	displayList.add(Op::rectangle,
+	    {rect.pos.x, rect.pos.y, rect.size.x, rect.size.y});
+}
+
+void DisplayListCanvas::circle(const Geom::Circle &circle)
+{
+	displayList.add(Op::circle,
+	    {circle.center.x, circle.center.y, circle.radius});
+}
+
+void DisplayListCanvas::line(const Geom::Line &line)
+{
+	displayList.add(Op::line,
+	    {line.begin.x, line.begin.y, line.end.x, line.end.y});
+}
+
+void DisplayListCanvas::text(const Geom::Rect &rect,
+    const std::string &str)
+{
+	displayList.add(Op::text,
+	    {rect.pos.x, rect.pos.y, rect.size.x, rect.size.y},
+	    str);
+}
+
+void DisplayListCanvas::setBrushGradient(const Geom::Line &line,
+    const Gfx::ColorGradient &gradient)
+{
+	brushColor = std::nullopt;
+	displayList.add(Op::setBrushGradient,
+	    {line.begin.x,
+	        line.begin.y,
+	        line.end.x,
+	        line.end.y,
+	        static_cast<double>(gradient.stops.size())});
+	for (const auto &stop : gradient.stops)
+		displayList.append({stop.pos,
+		    stop.value.red,
+		    stop.value.green,
+		    stop.value.blue,
+		    stop.value.alpha});
+}
+
+bool DisplayListCanvas::replay(const DisplayList &list)
+{
+	displayList.append(list, 0, list.getCommands().size());
+	// the replayed commands may have changed the states
+	resetStates();
+	return true;
+}
+
+void DisplayListCanvas::frameBegin()
+{
+	resetStates();
+	savedFonts.clear();
+	displayList.clear();
+}
+
+void DisplayListCanvas::transform(
+    const Geom::AffineTransform &transform)
+{
+	const auto &[r0, r1] = transform.getMatrix();
+	displayList.add(Op::transform,
+	    {r0[0], r1[0], r0[1], r1[1], r0[2], r1[2]});
+}
+
+void DisplayListCanvas::save()
+{
+	displayList.add(Op::save);
+	savedFonts.push_back(font);
+}
+
+void DisplayListCanvas::restore()
+{
+	displayList.add(Op::restore);
+	auto restoredFont = std::optional<Gfx::Font>();
+	if (!savedFonts.empty()) {
+		restoredFont = std::move(savedFonts.back());
+		savedFonts.pop_back();
+	}
+	resetStates();
+	// texts measured after restore need the font the context returns
+	// to
+	font = std::move(restoredFont);
+}
+
+void DisplayListCanvas::resetStates()
+{
+	font = std::nullopt;
+	brushColor = std::nullopt;
+	lineColor = std::nullopt;
+	lineWidth = std::nullopt;
+	clipRect = std::nullopt;
+}
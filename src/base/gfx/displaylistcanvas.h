@@ -0,0 +1,94 @@
+#ifndef GFX_DISPLAYLISTCANVAS
+#define GFX_DISPLAYLISTCANVAS
+
+#include <optional>
+#include <vector>
+
+#include "base/gfx/canvas.h"
+#include "base/gfx/displaylist.h"
+
+namespace Gfx
+{
+
+/**
+ * Canvas recording the draw calls into a display list. States set to
+ * their actual value again are not recorded; the states are unknown
+ * at the beginning and after restore(). Text color is recorded as
+ * brush color. Texts are measured with the font set on this canvas by
+ * the measuring canvas, if any. Replayed display lists are appended
+ * to the recorded one.
+ */
+class DisplayListCanvas : public ICanvas
+{
+public:
+	explicit DisplayListCanvas(ICanvas *measuringCanvas = nullptr);
+
+	Geom::Size textBoundary(const std::string &text) override;
+	std::vector<Geom::Size> textBoundaries(
+	    const std::vector<std::string> &texts) override;
+
+	Geom::Rect getClipRect() const override;
+	void setClipRect(const Geom::Rect &rect) override;
+	void setClipCircle(const Geom::Circle &circle) override;
+	void setClipPolygon() override;
+	void setBrushColor(const Gfx::Color &color) override;
+	void setLineColor(const Gfx::Color &color) override;
+	void setLineWidth(double width) override;
+	void setFont(const Gfx::Font &font) override;
+	void setTextColor(const Gfx::Color &color) override;
+
+	void beginDropShadow() override;
+	void setDropShadowBlur(uint64_t radius) override;
+	void setDropShadowColor(const Gfx::Color &color) override;
+	void setDropShadowOffset(const Geom::Point &offset) override;
+	void endDropShadow() override;
+
+	void beginPolygon() override;
+	void addPoint(const Geom::Point &point) override;
+	void addBezier(const Geom::Point &control0,
+	    const Geom::Point &control1,
+	    const Geom::Point &endPoint) override;
+	void closeSubpath() override;
+	void endPolygon() override;
+
+	void rectangle(const Geom::Rect &rect) override;
+	void circle(const Geom::Circle &circle) override;
+	void line(const Geom::Line &line) override;
+
+	void text(const Geom::Rect &rect,
+	    const std::string &text) override;
+
+	void setBrushGradient(const Geom::Line &line,
+	    const Gfx::ColorGradient &gradient) override;
+
+	bool canReplay() const override { return true; }
+	bool replay(const DisplayList &list) override;
+
+	void frameBegin() override;
+	void frameEnd() override {}
+
+	void transform(const Geom::AffineTransform &transform) override;
+	void save() override;
+	void restore() override;
+
+	const DisplayList &getDisplayList() const { return displayList; }
+	DisplayList &getDisplayList() { return displayList; }
+
+protected:
+	DisplayList displayList;
+	std::optional<Gfx::Font> font;
+
+	void resetStates();
+
+private:
+	ICanvas *measuringCanvas;
+	std::vector<std::optional<Gfx::Font>> savedFonts;
+	std::optional<Gfx::Color> brushColor;
+	std::optional<Gfx::Color> lineColor;
+	std::optional<double> lineWidth;
+	std::optional<Geom::Rect> clipRect;
+};
+
+}
+
+#endif
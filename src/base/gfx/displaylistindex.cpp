@@ -0,0 +1,225 @@
+#include "displaylistindex.h"
+
+#include <cmath>
+#include <limits>
+
+#include "base/geom/affinetransform.h"
+
+using namespace Gfx;
+
+using Op = DisplayList::Op;
+
+namespace
+{
+
+constexpr size_t none = std::numeric_limits<size_t>::max();
+
+struct DrawState
+{
+	Geom::AffineTransform transform;
+	double lineWidth{1};
+	double shadow{};
+};
+
+class ItemBounds
+{
+public:
+	explicit ItemBounds(const DrawState &state) : state(state) {}
+
+	void add(const Geom::Point &point)
+	{
+		auto transformed = state.transform(point);
+		rect = rect ? rect->boundary(transformed)
+		            : Geom::Rect(transformed);
+	}
+
+	void add(const Geom::Rect &original)
+	{
+		add(original.bottomLeft());
+		add(original.topRight());
+		add(Geom::Point(original.left(), original.top()));
+		add(Geom::Point(original.right(), original.bottom()));
+	}
+
+	std::optional<Geom::Rect> get() const
+	{
+		if (!rect) return std::nullopt;
+		auto margin = state.lineWidth / 2 + state.shadow;
+		return rect->outline(Geom::Size::Square(margin));
+	}
+
+private:
+	const DrawState &state;
+	std::optional<Geom::Rect> rect;
+};
+
+}
+
+DisplayListIndex::DisplayListIndex(const DisplayList &list)
+{
+	const auto &c = list.getCommands();
+
+	DrawState state;
+	std::vector<DrawState> saved;
+	States states{none, none, none, none};
+
+	std::optional<Item> item;
+	std::optional<Geom::Rect> itemBounds;
+	std::vector<std::optional<Geom::Rect>> boundaries;
+
+	auto addBounds = [&](const std::optional<Geom::Rect> &rect)
+	{
+		if (!rect) return;
+		itemBounds =
+		    itemBounds ? itemBounds->boundary(*rect) : *rect;
+		extent = extent ? extent->boundary(*rect) : *rect;
+	};
+
+	for (auto pos = 0u; pos < c.size();) {
+		auto size = list.commandSize(pos);
+		auto op = static_cast<Op>(c[pos]);
+		auto topLevel = saved.empty() && !item;
+		auto closes = false;
+		ItemBounds drawn(state);
+
+		switch (op) {
+		case Op::setBrushColor:
+		case Op::setBrushGradient:
+			if (saved.empty()) states[0] = pos;
+			break;
+		case Op::setLineColor:
+			if (saved.empty()) states[1] = pos;
+			break;
+		case Op::setLineWidth:
+			if (saved.empty()) states[2] = pos;
+			state.lineWidth = c[pos + 1];
+			break;
+		case Op::setFont:
+			if (saved.empty()) states[3] = pos;
+			break;
+		case Op::setClipRect:
+		case Op::setClipCircle:
+		case Op::setClipPolygon:
+		case Op::beginDropShadow:
+		case Op::setDropShadowColor:
+			if (saved.empty()) canCull = false;
+			break;
+		case Op::setDropShadowBlur:
+		case Op::setDropShadowOffset:
+			if (saved.empty()) canCull = false;
+			for (auto i = 1u; i < size; i++)
+				state.shadow += std::abs(c[pos + i]);
+			break;
+		case Op::endDropShadow:
+			if (saved.empty()) canCull = false;
+			state.shadow = 0;
+			break;
+		case Op::transform:
+			if (saved.empty()) canCull = false;
+			state.transform = state.transform
+			                * Geom::AffineTransform(c[pos + 1],
+			                    c[pos + 3],
+			                    c[pos + 5],
+			                    c[pos + 2],
+			                    c[pos + 4],
+			                    c[pos + 6]);
+			break;
+		case Op::save:
+			if (topLevel) item = Item{pos, none, states};
+			saved.push_back(state);
+			break;
+		case Op::restore:
+			if (saved.empty()) {
+				canCull = false;
+				break;
+			}
+			state = saved.back();
+			saved.pop_back();
+			closes = saved.empty() && item
+			      && static_cast<Op>(c[item->begin]) == Op::save;
+			break;
+		case Op::beginPolygon:
+			if (topLevel) item = Item{pos, none, states};
+			break;
+		case Op::endPolygon:
+			if (topLevel) canCull = false;
+			closes = saved.empty() && item
+			      && static_cast<Op>(c[item->begin])
+			             == Op::beginPolygon;
+			break;
+		case Op::addPoint:
+		case Op::addBezier:
+			if (topLevel) canCull = false;
+			for (auto i = 1u; i < size; i += 2)
+				drawn.add(Geom::Point(c[pos + i], c[pos + i + 1]));
+			break;
+		case Op::closeSubpath:
+			if (topLevel) canCull = false;
+			break;
+		case Op::rectangle:
+		case Op::text:
+			drawn.add(Geom::Rect(c[pos + 1],
+			    c[pos + 2],
+			    c[pos + 3],
+			    c[pos + 4]));
+			break;
+		case Op::circle: {
+			Geom::Point center(c[pos + 1], c[pos + 2]);
+			auto radius = Geom::Point(c[pos + 3], c[pos + 3]);
+			drawn.add(Geom::Rect(center - radius, radius * 2));
+			break;
+		}
+		case Op::line:
+			drawn.add(Geom::Point(c[pos + 1], c[pos + 2]));
+			drawn.add(Geom::Point(c[pos + 3], c[pos + 4]));
+			break;
+		}
+
+		if (topLevel
+		    && (op == Op::rectangle || op == Op::text
+		        || op == Op::circle || op == Op::line)) {
+			item = Item{pos, none, states};
+			closes = true;
+		}
+
+		addBounds(drawn.get());
+		pos += size;
+
+		if (closes) {
+			item->end = pos;
+			items.push_back(*item);
+			boundaries.push_back(itemBounds);
+			item.reset();
+			itemBounds.reset();
+		}
+	}
+
+	if (item || !saved.empty()) canCull = false;
+
+	index = Geom::SpatialIndex(boundaries);
+}
+
+DisplayList DisplayListIndex::select(const DisplayList &list,
+    const Geom::Rect &area) const
+{
+	DisplayList res;
+	if (!canCull) {
+		res.append(list, 0, list.getCommands().size());
+		return res;
+	}
+
+	States replayed{none, none, none, none};
+	for (auto i : index.find(area)) {
+		const auto &item = items[i];
+		for (auto s = 0u; s < item.states.size(); s++) {
+			auto offset = item.states[s];
+			if (offset == none || offset == replayed[s]) continue;
+			res.append(list,
+			    offset,
+			    offset + list.commandSize(offset));
+			replayed[s] = offset;
+		}
+		res.append(list, item.begin, item.end);
+	}
+	return res;
+}
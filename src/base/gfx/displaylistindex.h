@@ -0,0 +1,61 @@
+#ifndef GFX_DISPLAYLISTINDEX
+#define GFX_DISPLAYLISTINDEX
+
+#include <array>
+#include <cstddef>
+#include <optional>
+#include <vector>
+
+#include "base/geom/rect.h"
+#include "base/geom/spatialindex.h"
+#include "base/gfx/displaylist.h"
+
+namespace Gfx
+{
+
+/**
+ * Boundaries of the items drawn by a display list, for replaying only
+ * the items intersecting an area. Items are the paths, shapes and
+ * texts drawn outside of save() - restore() pairs, and these pairs
+ * themselves. The states set outside of the pairs are replayed before
+ * each selected item, so skipped items do not change how the others
+ * are drawn. Lists changing the clip, the transform or the drop shadow
+ * outside of save() - restore() pairs are not culled.
+ */
+class DisplayListIndex
+{
+public:
+	explicit DisplayListIndex(const DisplayList &list);
+
+	/** Area covered by the drawn items; nullopt if nothing is drawn.
+	 */
+	const std::optional<Geom::Rect> &bounds() const { return extent; }
+	bool cullable() const { return canCull; }
+	size_t size() const { return items.size(); }
+
+	/** Commands of the indexed list drawing what it draws in the area.
+	 */
+	DisplayList select(const DisplayList &list,
+	    const Geom::Rect &area) const;
+
+private:
+	/** Offsets of the brush, line color, line width and font commands
+	 *  in effect. */
+	typedef std::array<size_t, 4> States;
+
+	struct Item
+	{
+		size_t begin;
+		size_t end;
+		States states;
+	};
+
+	std::vector<Item> items;
+	Geom::SpatialIndex index;
+	std::optional<Geom::Rect> extent;
+	bool canCull{true};
+};
+
+}
+
+#endif
@@ -1,50 +1,87 @@
 #include "pathsampler.h"
 
+#include <algorithm>
+#include <array>
+
 #include "base/geom/triangle.h"
 
 using namespace Geom;
 using namespace Gfx;
 
-void PathSampler::calc()
+void PathSampler::getPoints(std::span<const double> fs,
+    std::span<Point> points)
 {
-	auto point0 = getPoint(0.0);
-	auto point1 = getPoint(1.0);
-
-	addPoint(point0);
-	path(point0, point1, 0.0, 1.0);
-	addPoint(point1);
+	for (auto i = 0u; i < fs.size(); i++) points[i] = getPoint(fs[i]);
 }
 
-void PathSampler::path(const Point &pConv0,
-    const Point &pConv1,
-    double i0,
-    double i1,
-    size_t recurseCnt)
+/**
+ * Bisects the path level by level, so that the midpoints of a level are
+ * sampled in one batch. The samples are emitted in parameter order,
+ * the same points a depth-first bisection would emit.
+ */
+void PathSampler::calc()
 {
-	const size_t maxRecursion = 20;
-	if (recurseCnt >= maxRecursion) return;
+	const size_t maxDepth = 20;
+
+	std::array<double, 2> ends{0.0, 1.0};
+	std::array<Point, 2> endPoints;
+	getPoints(ends, endPoints);
+
+	std::vector<Segment> level{{endPoints[0], endPoints[1], 0.0, 1.0}};
+	std::vector<Segment> nextLevel;
+	std::vector<double> params;
+	std::vector<Point> points;
+	std::vector<Sample> samples;
+
+	for (auto depth = 0u; depth < maxDepth && !level.empty(); depth++) {
+		params.clear();
+		for (const auto &segment : level)
+			params.push_back((segment.i0 + segment.i1) / 2.0);
+
+		points.resize(params.size());
+		getPoints(params, points);
+
+		nextLevel.clear();
+		for (auto j = 0u; j < level.size(); j++) {
+			const auto &segment = level[j];
+			const auto &pConv = points[j];
+			auto i = params[j];
+
+			samples.push_back({i, pConv});
 
-	auto i = (i0 + i1) / 2.0;
-	auto pConv = getPoint(i);
+			if (needMore(segment.pConv0, pConv, segment.pConv1)) {
+				if ((pConv - segment.pConv0).sqrAbs() > dMax)
+					nextLevel.push_back(
+					    {segment.pConv0, pConv, segment.i0, i});
+				if ((pConv - segment.pConv1).sqrAbs() > dMax)
+					nextLevel.push_back(
+					    {pConv, segment.pConv1, i, segment.i1});
+			}
+		}
+		std::swap(level, nextLevel);
+	}
+
+	std::sort(samples.begin(),
+	    samples.end(),
+	    [](const Sample &a, const Sample &b)
+	    {
+		    return a.i < b.i;
+	    });
 
+	addPoint(endPoints[0]);
+	for (const auto &sample : samples) addPoint(sample.point);
+	addPoint(endPoints[1]);
+}
+
+bool PathSampler::needMore(const Point &pConv0,
+    const Point &pConv,
+    const Point &pConv1) const
+{
 	Geom::Triangle triangle(pConv0, pConv, pConv1);
 	auto area = triangle.area();
 	auto height = 2 * area / (pConv1 - pConv0).abs();
 
-	auto needMore =
-	    height > hMax
+	return height > hMax
 	    || ((pConv1 - pConv0).sqrAbs() < (pConv - pConv0).sqrAbs())
 	    || ((pConv1 - pConv0).sqrAbs() < (pConv - pConv1).sqrAbs());
-
-	if (needMore) {
-		if ((pConv - pConv0).sqrAbs() > dMax)
-			path(pConv0, pConv, i0, i, recurseCnt + 1);
-	}
-
-	addPoint(pConv);
-
-	if (needMore) {
-		if ((pConv - pConv1).sqrAbs() > dMax)
-			path(pConv, pConv1, i, i1, recurseCnt + 1);
-	}
 }
@@ -2,6 +2,8 @@
 #define GFX_PATHSAMPLER
 
 #include <cstddef>
+#include <span>
+#include <vector>
 
 #include "base/geom/point.h"
 
@@ -21,15 +23,30 @@ protected:
 
 	virtual void addPoint(const Geom::Point &) = 0;
 	virtual Geom::Point getPoint(double f) = 0;
+	/** Samples several parameters at once, one by one by default. */
+	virtual void getPoints(std::span<const double> fs,
+	    std::span<Geom::Point> points);
 
 	void calc();
 
 private:
-	void path(const Geom::Point &pConv0,
-	    const Geom::Point &pConv1,
-	    double i0,
-	    double i1,
-	    size_t recurseCnt = 0);
+	struct Segment
+	{
+		Geom::Point pConv0;
+		Geom::Point pConv1;
+		double i0;
+		double i1;
+	};
+
+	struct Sample
+	{
+		double i;
+		Geom::Point point;
+	};
+
+	bool needMore(const Geom::Point &pConv0,
+	    const Geom::Point &pConv,
+	    const Geom::Point &pConv1) const;
 };
 
 }
@@ -0,0 +1,247 @@
+#include "textmetrics.h"
+
+using namespace Gfx;
+
+TextMetricsCache::TextMetricsCache(size_t capacity) :
+    capacity(capacity)
+{}
+
+std::string TextMetricsCache::key(const std::string &font,
+    const std::string &text)
+{
+	return font + '\n' + text;
+}
+
+const Geom::Size *TextMetricsCache::find(const std::string &font,
+    const std::string &text)
+{
+	auto it = index.find(key(font, text));
+	if (it == index.end()) return nullptr;
+
+	entries.splice(entries.begin(), entries, it->second);
+	return &it->second->second;
+}
+
+void TextMetricsCache::insert(const std::string &font,
+    const std::string &text,
+    const Geom::Size &size)
+{
+	auto entryKey = key(font, text);
+	if (auto it = index.find(entryKey); it != index.end()) {
+		it->second->second = size;
+		entries.splice(entries.begin(), entries, it->second);
+		return;
+	}
+
+	if (capacity == 0) return;
+
+	if (entries.size() >= capacity) {
+		index.erase(entries.back().first);
+		entries.pop_back();
+	}
+
+	entries.emplace_front(entryKey, size);
+	index.emplace(std::move(entryKey), entries.begin());
+}
+
+void TextMetricsCache::clear()
+{
+	entries.clear();
+	index.clear();
+}
+
+TextMetricsCanvas::TextMetricsCanvas(ICanvas &canvas,
+    TextMetricsCache &cache) :
+    canvas(canvas),
+    cache(cache)
+{}
+
+Geom::Size TextMetricsCanvas::textBoundary(const std::string &string)
+{
+	if (font.empty()) return canvas.textBoundary(string);
+
+	if (const auto *size = cache.find(font, string)) return *size;
+
+	auto res = canvas.textBoundary(string);
+	cache.insert(font, string, res);
+	return res;
+}
+
+std::vector<Geom::Size> TextMetricsCanvas::textBoundaries(
+    const std::vector<std::string> &strings)
+{
+	if (font.empty()) return canvas.textBoundaries(strings);
+
+	std::vector<Geom::Size> res(strings.size());
+	std::vector<std::string> missing;
+	std::vector<size_t> missingIndices;
+
+	for (auto i = 0u; i < strings.size(); i++) {
+		if (const auto *size = cache.find(font, strings[i]))
+			res[i] = *size;
+		else {
+			missing.push_back(strings[i]);
+			missingIndices.push_back(i);
+		}
+	}
+
+	if (missing.empty()) return res;
+
+	auto measured = canvas.textBoundaries(missing);
+	for (auto i = 0u; i < missing.size(); i++) {
+		cache.insert(font, missing[i], measured[i]);
+		res[missingIndices[i]] = measured[i];
+	}
+	return res;
+}
+
+Geom::Rect TextMetricsCanvas::getClipRect() const
+{
+	return canvas.getClipRect();
+}
+
+void TextMetricsCanvas::setClipRect(const Geom::Rect &rect)
+{
+	canvas.setClipRect(rect);
+}
+
+void TextMetricsCanvas::setClipCircle(const Geom::Circle &circle)
+{
+	canvas.setClipCircle(circle);
+}
+
+void TextMetricsCanvas::setClipPolygon() { canvas.setClipPolygon(); }
+
+void TextMetricsCanvas::setBrushColor(const Gfx::Color &color)
+{
+	canvas.setBrushColor(color);
+}
+
+void TextMetricsCanvas::setLineColor(const Gfx::Color &color)
+{
+	canvas.setLineColor(color);
+}
+
+void TextMetricsCanvas::setTextColor(const Gfx::Color &color)
+{
+	canvas.setTextColor(color);
+}
+
+void TextMetricsCanvas::setLineWidth(double width)
+{
+	canvas.setLineWidth(width);
+}
+
+void TextMetricsCanvas::setFont(const Gfx::Font &font)
+{
+	this->font = font.toCSS();
+	canvas.setFont(font);
+}
+
+void TextMetricsCanvas::transform(
+    const Geom::AffineTransform &transform)
+{
+	canvas.transform(transform);
+}
+
+void TextMetricsCanvas::save()
+{
+	savedFonts.push_back(font);
+	canvas.save();
+}
+
+void TextMetricsCanvas::restore()
+{
+	if (!savedFonts.empty()) {
+		font = std::move(savedFonts.back());
+		savedFonts.pop_back();
+	}
+	canvas.restore();
+}
+
+void TextMetricsCanvas::beginDropShadow() { canvas.beginDropShadow(); }
+
+void TextMetricsCanvas::setDropShadowBlur(uint64_t radius)
+{
+	canvas.setDropShadowBlur(radius);
+}
+
+void TextMetricsCanvas::setDropShadowColor(const Gfx::Color &color)
+{
+	canvas.setDropShadowColor(color);
+}
+
+void TextMetricsCanvas::setDropShadowOffset(const Geom::Point &offset)
+{
+	canvas.setDropShadowOffset(offset);
+}
+
+void TextMetricsCanvas::endDropShadow() { canvas.endDropShadow(); }
+
+void TextMetricsCanvas::beginPolygon() { canvas.beginPolygon(); }
+
+void TextMetricsCanvas::addPoint(const Geom::Point &point)
+{
+	canvas.addPoint(point);
+}
+
+void TextMetricsCanvas::addBezier(const Geom::Point &control0,
+    const Geom::Point &control1,
+    const Geom::Point &endPoint)
+{
+	canvas.addBezier(control0, control1, endPoint);
+}
+
+void TextMetricsCanvas::closeSubpath() { canvas.closeSubpath(); }
+
+void TextMetricsCanvas::endPolygon() { canvas.endPolygon(); }
+
+void TextMetricsCanvas::rectangle(const Geom::Rect &rect)
+{
+	canvas.rectangle(rect);
+}
+
+void TextMetricsCanvas::circle(const Geom::Circle &circle)
+{
+	canvas.circle(circle);
+}
+
+void TextMetricsCanvas::line(const Geom::Line &line)
+{
+	canvas.line(line);
+}
+
+void TextMetricsCanvas::text(const Geom::Rect &rect,
+    const std::string &text)
+{
+	canvas.text(rect, text);
+}
+
+void TextMetricsCanvas::setBrushGradient(const Geom::Line &line,
+    const ColorGradient &gradient)
+{
+	canvas.setBrushGradient(line, gradient);
+}
+
+bool TextMetricsCanvas::replay(const DisplayList &list)
+{
+	if (!canvas.replay(list)) return false;
+	// the replayed commands may have changed the font
+	font.clear();
+	return true;
+}
+
+bool TextMetricsCanvas::repaintArea(const Geom::Rect &area)
+{
+	return canvas.repaintArea(area);
+}
+
+void TextMetricsCanvas::frameBegin()
+{
+	savedFonts.clear();
+	canvas.frameBegin();
+}
+
+void TextMetricsCanvas::frameEnd() { canvas.frameEnd(); }
+
+void *TextMetricsCanvas::getPainter() { return canvas.getPainter(); }
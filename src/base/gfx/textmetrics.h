@@ -0,0 +1,113 @@
+#ifndef GFX_TEXTMETRICS
+#define GFX_TEXTMETRICS
+
+#include <cstddef>
+#include <list>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "base/gfx/canvas.h"
+
+namespace Gfx
+{
+
+/**
+ * Least recently used cache of text sizes keyed by the CSS form of the
+ * font and the measured string.
+ */
+class TextMetricsCache
+{
+public:
+	explicit TextMetricsCache(size_t capacity = 4096);
+
+	const Geom::Size *find(const std::string &font,
+	    const std::string &text);
+	void insert(const std::string &font,
+	    const std::string &text,
+	    const Geom::Size &size);
+	void clear();
+	size_t size() const { return entries.size(); }
+
+private:
+	typedef std::pair<std::string, Geom::Size> Entry;
+
+	size_t capacity;
+	std::list<Entry> entries;
+	std::unordered_map<std::string, std::list<Entry>::iterator> index;
+
+	static std::string key(const std::string &font,
+	    const std::string &text);
+};
+
+/**
+ * Canvas decorator answering text measurements from a TextMetricsCache,
+ * everything else is forwarded to the wrapped canvas. Measurements
+ * before the first setFont call are not cached, as the font of the
+ * wrapped canvas is unknown then.
+ */
+class TextMetricsCanvas : public ICanvas
+{
+public:
+	TextMetricsCanvas(ICanvas &canvas, TextMetricsCache &cache);
+
+	Geom::Size textBoundary(const std::string &string) override;
+	std::vector<Geom::Size> textBoundaries(
+	    const std::vector<std::string> &strings) override;
+	Geom::Rect getClipRect() const override;
+	void setClipRect(const Geom::Rect &rect) override;
+	void setClipCircle(const Geom::Circle &circle) override;
+	void setClipPolygon() override;
+	void setBrushColor(const Gfx::Color &color) override;
+	void setLineColor(const Gfx::Color &color) override;
+	void setTextColor(const Gfx::Color &color) override;
+	void setLineWidth(double width) override;
+	void setFont(const Gfx::Font &font) override;
+
+	void transform(const Geom::AffineTransform &transform) override;
+	void save() override;
+	void restore() override;
+	void beginDropShadow() override;
+	void setDropShadowBlur(uint64_t radius) override;
+	void setDropShadowColor(const Gfx::Color &color) override;
+	void setDropShadowOffset(const Geom::Point &offset) override;
+	void endDropShadow() override;
+
+	void beginPolygon() override;
+	void addPoint(const Geom::Point &point) override;
+	void addBezier(const Geom::Point &control0,
+	    const Geom::Point &control1,
+	    const Geom::Point &endPoint) override;
+	void closeSubpath() override;
+	void endPolygon() override;
+
+	void rectangle(const Geom::Rect &rect) override;
+	void circle(const Geom::Circle &circle) override;
+	void line(const Geom::Line &line) override;
+
+	void text(const Geom::Rect &rect,
+	    const std::string &text) override;
+
+	void setBrushGradient(const Geom::Line &line,
+	    const ColorGradient &gradient) override;
+
+	bool canReplay() const override { return canvas.canReplay(); }
+	bool replay(const DisplayList &list) override;
+	bool repaintArea(const Geom::Rect &area) override;
+
+	void frameBegin() override;
+	void frameEnd() override;
+
+	void *getPainter() override;
+
+private:
+	ICanvas &canvas;
+	TextMetricsCache &cache;
+	std::string font;
+	std::vector<std::string> savedFonts;
+};
+
+}
+
+#endif
@@ -1,21 +1,97 @@
-
 #include "scheduler.h"
 
+#include <algorithm>
+
 using namespace GUI;
 
+bool TaskQueue::Later::operator()(const Entry &a, const Entry &b) const
+{
+	if (a.time != b.time) return a.time > b.time;
+	return a.sequence > b.sequence;
+}
+
+bool TaskQueue::LessUrgent::operator()(const Entry &a,
+    const Entry &b) const
+{
+	if (a.priority != b.priority) return a.priority < b.priority;
+	return Later{}(a, b);
+}
+
+void TaskQueue::schedule(const Scheduler::Task &task, TimePoint time)
+{
+	schedule(task, time, Priority::normal);
+}
+
 void TaskQueue::schedule(const Scheduler::Task &task,
-    std::chrono::steady_clock::time_point time)
+    TimePoint time,
+    Priority priority,
+    const void *key)
+{
+	Entry entry{time, priority, sequence++, key, task};
+
+	if (key) {
+		if (coalesce(due, entry)) {
+			std::make_heap(due.begin(), due.end(), LessUrgent{});
+			return;
+		}
+		if (coalesce(pending, entry)) {
+			std::make_heap(pending.begin(), pending.end(), Later{});
+			return;
+		}
+	}
+
+	pending.push_back(std::move(entry));
+	std::push_heap(pending.begin(), pending.end(), Later{});
+}
+
+bool TaskQueue::coalesce(std::vector<Entry> &heap, Entry &entry)
+{
+	auto it = std::find_if(heap.begin(),
+	    heap.end(),
+	    [&](const Entry &other)
+	    {
+		    return other.key == entry.key;
+	    });
+	if (it == heap.end()) return false;
+
+	it->task = std::move(entry.task);
+	it->time = std::min(it->time, entry.time);
+	it->priority = std::max(it->priority, entry.priority);
+	return true;
+}
+
+template <class Compare>
+TaskQueue::Entry TaskQueue::pop(std::vector<Entry> &heap)
 {
-	tasks.insert({time, task});
+	std::pop_heap(heap.begin(), heap.end(), Compare{});
+	auto res = std::move(heap.back());
+	heap.pop_back();
+	return res;
 }
 
-void TaskQueue::poll()
+bool TaskQueue::poll(Clock::duration budget)
 {
-	auto now = std::chrono::steady_clock::now();
-	auto oldestIt = tasks.begin();
-	while (oldestIt != tasks.end() && oldestIt->first <= now) {
-		oldestIt->second();
-		tasks.erase(oldestIt);
-		oldestIt = tasks.begin();
+	auto start = Clock::now();
+
+	while (!pending.empty() && pending.front().time <= start) {
+		due.push_back(pop<Later>(pending));
+		std::push_heap(due.begin(), due.end(), LessUrgent{});
+	}
+
+	while (!due.empty()) {
+		// popped before running, so the task may schedule new ones
+		pop<LessUrgent>(due).task();
+		if (Clock::now() - start >= budget) break;
 	}
+
+	return !due.empty();
+}
+
+std::optional<Scheduler::TimePoint> TaskQueue::nextDeadline() const
+{
+	std::optional<TimePoint> res;
+	if (!pending.empty()) res = pending.front().time;
+	for (const auto &entry : due)
+		if (!res || entry.time < *res) res = entry.time;
+	return res;
 }
@@ -2,9 +2,11 @@
 #define GUI_SCHEDULER
 
 #include <chrono>
+#include <cstdint>
 #include <functional>
-#include <map>
 #include <memory>
+#include <optional>
+#include <vector>
 
 namespace GUI
 {
@@ -12,24 +14,82 @@ namespace GUI
 struct Scheduler
 {
 	typedef std::function<void(void)> Task;
+	typedef std::chrono::steady_clock::time_point TimePoint;
+
+	enum class Priority : uint8_t { low, normal, high };
 
 	virtual ~Scheduler() {}
 
+	virtual void schedule(const Task &task, TimePoint time) = 0;
+
+	/**
+	 * Schedules with a priority. A task scheduled with the key of a
+	 * still pending task replaces it instead of queuing up behind it.
+	 * Schedulers without priorities run it as a plain task.
+	 */
 	virtual void schedule(const Task &task,
-	    std::chrono::steady_clock::time_point time) = 0;
+	    TimePoint time,
+	    Priority,
+	    const void * /*key*/ = nullptr)
+	{
+		schedule(task, time);
+	}
 };
 
 typedef std::shared_ptr<Scheduler> SchedulerPtr;
 
+/**
+ * Scheduler driven by repeated poll() calls of the host. Pending tasks
+ * wait in a binary heap ordered by their time; the due ones move to a
+ * second heap ordered by priority. A poll stops after its time budget
+ * is spent, leaving the rest due for the next one.
+ */
 class TaskQueue : public Scheduler
 {
 public:
+	typedef std::chrono::steady_clock Clock;
+
+	void schedule(const Task &task, TimePoint time) override;
 	void schedule(const Task &task,
-	    std::chrono::steady_clock::time_point time) override;
-	void poll();
+	    TimePoint time,
+	    Priority priority,
+	    const void *key = nullptr) override;
+
+	/** Returns whether due tasks were left for the next poll. */
+	bool poll(Clock::duration budget = Clock::duration::max());
+
+	/** Time of the earliest pending task, if any. */
+	std::optional<TimePoint> nextDeadline() const;
+
+	size_t size() const { return pending.size() + due.size(); }
 
 private:
-	std::multimap<std::chrono::steady_clock::time_point, Task> tasks;
+	struct Entry
+	{
+		TimePoint time;
+		Priority priority;
+		uint64_t sequence;
+		const void *key;
+		Task task;
+	};
+
+	struct Later
+	{
+		bool operator()(const Entry &a, const Entry &b) const;
+	};
+
+	struct LessUrgent
+	{
+		bool operator()(const Entry &a, const Entry &b) const;
+	};
+
+	std::vector<Entry> pending;
+	std::vector<Entry> due;
+	uint64_t sequence{};
+
+	bool coalesce(std::vector<Entry> &heap, Entry &entry);
+	template <class Compare>
+	static Entry pop(std::vector<Entry> &heap);
 };
 
 }
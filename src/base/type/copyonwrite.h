@@ -0,0 +1,51 @@
+#ifndef TYPE_COPYONWRITE
+#define TYPE_COPYONWRITE
+
+#include <memory>
+#include <utility>
+
+namespace Type
+{
+
+/**
+ * Value wrapper sharing its content between copies until one of
+ * them is modified through write().
+ */
+template <typename T> class CopyOnWrite
+{
+public:
+	CopyOnWrite() : data(std::make_shared<T>()) {}
+
+	CopyOnWrite(T value) :
+	    data(std::make_shared<T>(std::move(value)))
+	{}
+
+	CopyOnWrite &operator=(T value)
+	{
+		data = std::make_shared<T>(std::move(value));
+		return *this;
+	}
+
+	const T &operator*() const { return *data; }
+	const T *operator->() const { return data.get(); }
+
+	T &write()
+	{
+		if (data.use_count() > 1) data = std::make_shared<T>(*data);
+		return *data;
+	}
+
+	bool isShared() const { return data.use_count() > 1; }
+
+	bool sharesWith(const CopyOnWrite &other) const
+	{
+		return data == other.data;
+	}
+
+private:
+	std::shared_ptr<T> data;
+};
+
+}
+
+#endif
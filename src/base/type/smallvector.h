@@ -0,0 +1,211 @@
+#ifndef TYPE_SMALLVECTOR
+#define TYPE_SMALLVECTOR
+
+#include <algorithm>
+#include <cstddef>
+#include <initializer_list>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace Type
+{
+
+/**
+ * Vector-like container which keeps up to N elements inline and
+ * falls back to heap storage only above that size. The inline buffer
+ * and the heap pointer share their storage.
+ */
+template <typename T, std::size_t N> class SmallVector
+{
+	static_assert(std::is_trivially_copyable_v<T>,
+	    "SmallVector supports trivially copyable types only");
+	static_assert(N > 0, "SmallVector needs inline capacity");
+
+public:
+	typedef T value_type;
+	typedef std::size_t size_type;
+	typedef T &reference;
+	typedef const T &const_reference;
+	typedef T *iterator;
+	typedef const T *const_iterator;
+
+	SmallVector() = default;
+
+	explicit SmallVector(size_type size, const T &value = T())
+	{
+		resize(size, value);
+	}
+
+	SmallVector(std::initializer_list<T> values)
+	{
+		reserve(values.size());
+		for (const auto &value : values) push_back(value);
+	}
+
+	SmallVector(const SmallVector &other) { assign(other); }
+
+	SmallVector(SmallVector &&other) noexcept { take(other); }
+
+	SmallVector &operator=(const SmallVector &other)
+	{
+		if (this != &other) {
+			count = 0;
+			assign(other);
+		}
+		return *this;
+	}
+
+	SmallVector &operator=(SmallVector &&other) noexcept
+	{
+		if (this != &other) {
+			release();
+			take(other);
+		}
+		return *this;
+	}
+
+	~SmallVector() { release(); }
+
+	static constexpr size_type inlineCapacity() { return N; }
+	bool isInline() const { return allocated == 0; }
+
+	size_type size() const { return count; }
+	bool empty() const { return count == 0; }
+	size_type capacity() const { return isInline() ? N : allocated; }
+
+	T *data() { return isInline() ? storage.local : storage.heap; }
+	const T *data() const
+	{
+		return isInline() ? storage.local : storage.heap;
+	}
+
+	iterator begin() { return data(); }
+	iterator end() { return data() + count; }
+	const_iterator begin() const { return data(); }
+	const_iterator end() const { return data() + count; }
+
+	T &operator[](size_type index) { return data()[index]; }
+	const T &operator[](size_type index) const
+	{
+		return data()[index];
+	}
+
+	T &at(size_type index)
+	{
+		if (index >= count)
+			throw std::out_of_range("small vector index out of range");
+		return data()[index];
+	}
+
+	const T &at(size_type index) const
+	{
+		if (index >= count)
+			throw std::out_of_range("small vector index out of range");
+		return data()[index];
+	}
+
+	T &front() { return data()[0]; }
+	const T &front() const { return data()[0]; }
+	T &back() { return data()[count - 1]; }
+	const T &back() const { return data()[count - 1]; }
+
+	void reserve(size_type size)
+	{
+		if (size <= capacity()) return;
+
+		auto *heap = new T[size];
+		std::copy_n(data(), count, heap);
+		release();
+		storage.heap = heap;
+		allocated = size;
+	}
+
+	void push_back(const T &value)
+	{
+		if (count == capacity()) {
+			auto copy = value;
+			reserve(2 * capacity());
+			data()[count++] = copy;
+		}
+		else
+			data()[count++] = value;
+	}
+
+	template <typename... Args> T &emplace_back(Args &&...args)
+	{
+		push_back(T{std::forward<Args>(args)...});
+		return back();
+	}
+
+	void pop_back() { count--; }
+
+	void resize(size_type size, const T &value = T())
+	{
+		if (size > count) {
+			auto copy = value;
+			reserve(size);
+			std::fill(data() + count, data() + size, copy);
+		}
+		count = size;
+	}
+
+	void clear()
+	{
+		release();
+		count = 0;
+	}
+
+	bool operator==(const SmallVector &other) const
+	{
+		return std::equal(begin(), end(), other.begin(), other.end());
+	}
+
+	bool operator<(const SmallVector &other) const
+	{
+		return std::lexicographical_compare(begin(),
+		    end(),
+		    other.begin(),
+		    other.end());
+	}
+
+private:
+	union Storage {
+		T local[N];
+		T *heap;
+	};
+
+	size_type count{};
+	size_type allocated{};
+	Storage storage{};
+
+	void assign(const SmallVector &other)
+	{
+		reserve(other.count);
+		std::copy_n(other.data(), other.count, data());
+		count = other.count;
+	}
+
+	void take(SmallVector &other)
+	{
+		count = other.count;
+		allocated = other.allocated;
+		if (other.isInline())
+			std::copy_n(other.storage.local, count, storage.local);
+		else
+			storage.heap = other.storage.heap;
+		other.allocated = 0;
+		other.count = 0;
+	}
+
+	void release()
+	{
+		if (isInline()) return;
+		delete[] storage.heap;
+		allocated = 0;
+	}
+};
+
+}
+
+#endif
@@ -14,7 +14,7 @@ public:
 	operator Type &() { return value; }
 
 protected:
-	Type value;
+	Type value{};
 };
 
 }
@@ -0,0 +1,110 @@
+#include "workerpool.h"
+
+#include <algorithm>
+#include <utility>
+
+using namespace Util;
+
+WorkerPool::WorkerPool(size_t threadCount) :
+    stopping(false),
+    generation(0),
+    busy(0),
+    task(nullptr),
+    count(0),
+    chunkSize(1),
+    nextChunk(0)
+{
+	for (auto i = 1u; i < threadCount; i++)
+		threads.emplace_back(
+		    [this]
+		    {
+			    work();
+		    });
+}
+
+WorkerPool::~WorkerPool()
+{
+	{
+		std::lock_guard lock(mutex);
+		stopping = true;
+	}
+	wakeUp.notify_all();
+	for (auto &thread : threads) thread.join();
+}
+
+void WorkerPool::forEach(size_t count,
+    size_t chunkSize,
+    const Task &task)
+{
+	chunkSize = std::max<size_t>(chunkSize, 1);
+
+	if (threads.empty() || count <= chunkSize) {
+		if (count > 0) task(0, count);
+		return;
+	}
+
+	{
+		std::lock_guard lock(mutex);
+		this->task = &task;
+		this->count = count;
+		this->chunkSize = chunkSize;
+		nextChunk = 0;
+		error = nullptr;
+		busy = threads.size();
+		generation++;
+	}
+	wakeUp.notify_all();
+
+	runChunks();
+
+	std::exception_ptr failure;
+	{
+		std::unique_lock lock(mutex);
+		done.wait(lock,
+		    [this]
+		    {
+			    return busy == 0;
+		    });
+		this->task = nullptr;
+		failure = std::exchange(error, nullptr);
+	}
+	if (failure) std::rethrow_exception(failure);
+}
+
+void WorkerPool::work()
+{
+	size_t seen = 0;
+	while (true) {
+		{
+			std::unique_lock lock(mutex);
+			wakeUp.wait(lock,
+			    [&]
+			    {
+				    return stopping || generation != seen;
+			    });
+			if (stopping) return;
+			seen = generation;
+		}
+
+		runChunks();
+
+		std::lock_guard lock(mutex);
+		if (--busy == 0) done.notify_one();
+	}
+}
+
+void WorkerPool::runChunks()
+{
+	while (true) {
+		auto begin = nextChunk.fetch_add(1) * chunkSize;
+		if (begin >= count) return;
+		auto end = std::min(begin + chunkSize, count);
+		try {
+			(*task)(begin, end);
+		}
+		catch (...) {
+			std::lock_guard lock(mutex);
+			if (!error) error = std::current_exception();
+		}
+	}
+}
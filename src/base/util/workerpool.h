@@ -0,0 +1,58 @@
+#ifndef UTIL_WORKERPOOL
+#define UTIL_WORKERPOOL
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace Util
+{
+
+/**
+ * Fixed set of threads executing index ranges in parallel. The caller
+ * of forEach takes part in the work and returns only after every chunk
+ * has been processed. Idle threads keep claiming the next unprocessed
+ * chunk, so uneven chunks are balanced between them.
+ */
+class WorkerPool
+{
+public:
+	typedef std::function<void(size_t begin, size_t end)> Task;
+
+	explicit WorkerPool(size_t threadCount =
+	                        std::thread::hardware_concurrency());
+	WorkerPool(const WorkerPool &) = delete;
+	WorkerPool &operator=(const WorkerPool &) = delete;
+	~WorkerPool();
+
+	size_t size() const { return threads.size() + 1; }
+
+	void forEach(size_t count, size_t chunkSize, const Task &task);
+
+private:
+	std::vector<std::thread> threads;
+	std::mutex mutex;
+	std::condition_variable wakeUp;
+	std::condition_variable done;
+	bool stopping;
+	size_t generation;
+	size_t busy;
+
+	const Task *task;
+	size_t count;
+	size_t chunkSize;
+	std::atomic<size_t> nextChunk;
+	std::exception_ptr error;
+
+	void work();
+	void runChunks();
+};
+
+}
+
+#endif
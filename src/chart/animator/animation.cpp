@@ -17,7 +17,10 @@ Animation::Animation(const Gen::PlotPtr &plot) :
 		    if (!::Anim::Sequence::actual) return;
 		    auto plot = ::Anim::Sequence::actual->data();
 		    if (!plot) return;
-		    onPlotChanged(std::static_pointer_cast<Gen::Plot>(std::move(plot)));
+		    onProgress();
+		    if (::Anim::Sequence::isDirty())
+			    onPlotChanged(
+			        std::static_pointer_cast<Gen::Plot>(std::move(plot)));
 	    });
 
 	::Anim::Control::setOnFinish(
@@ -36,6 +39,24 @@ void Animation::addKeyframe(const Gen::PlotPtr &next,
 	if (!next) return;
 	next->detachOptions();
 
+	if (planCache && target) {
+		PlanCache::Key key(*target, *next, options);
+		auto hit = planCache->get(key);
+		if (hit.plan.empty()) {
+			hit.plan = plan(next, options);
+			planCache->add(std::move(key), hit.plan);
+		}
+		play(hit.plan, next, options, hit.reversed);
+	}
+	else
+		play(plan(next, options), next, options);
+
+	target = next;
+}
+
+PlanCache::Plan Animation::plan(const Gen::PlotPtr &next,
+    const Options::Keyframe &options) const
+{
 	auto strategy = options.getRegroupStrategy();
 
 	if (!target || target->isEmpty() || !next || next->isEmpty()
@@ -44,18 +65,19 @@ void Animation::addKeyframe(const Gen::PlotPtr &next,
 		strategy = RegroupStrategy::fade;
 	}
 
-	Vizzu::Gen::PlotPtr intermediate0;
-	Vizzu::Gen::PlotPtr intermediate1;
+	PlanCache::Step step0;
+	PlanCache::Step step1;
 
 	if (strategy == RegroupStrategy::drilldown) {
-		intermediate0 = getIntermediate(target,
+		step0.intermediate = getIntermediate(target,
 		    next,
 		    [=](auto &base, const auto &other)
 		    {
 			    base.drilldownTo(other);
 		    });
+		step0.onSource = true;
 
-		intermediate1 = getIntermediate(next,
+		step1.intermediate = getIntermediate(next,
 		    target,
 		    [=](auto &base, const auto &other)
 		    {
@@ -101,67 +123,88 @@ void Animation::addKeyframe(const Gen::PlotPtr &next,
 		};
 
 		if (basedOnSource) {
-			intermediate0 =
+			step0.intermediate =
 			    getIntermediate(target, next, getModifier(true));
-			intermediate1 =
+			step1.intermediate =
 			    getIntermediate(target, next, getModifier(false));
 		}
 		else {
-			intermediate0 =
+			step0.intermediate =
 			    getIntermediate(next, target, getModifier(false));
-			intermediate1 =
+			step1.intermediate =
 			    getIntermediate(next, target, getModifier(true));
 		}
+		step0.onSource = step1.onSource = basedOnSource;
 	}
 
-	auto begin = target;
-	if (intermediate0) {
-		addKeyframe(target,
-		    intermediate0,
-		    options,
-		    strategy == RegroupStrategy::drilldown);
-		begin = intermediate0;
+	PlanCache::Plan res;
+	if (step0.intermediate) {
+		step0.canBeInstant = strategy == RegroupStrategy::drilldown;
+		res.push_back(step0);
 	}
-	if (intermediate1) {
-		addKeyframe(begin,
-		    intermediate1,
-		    options,
-		    strategy == RegroupStrategy::aggregate);
-		begin = intermediate1;
+	if (step1.intermediate) {
+		step1.canBeInstant = strategy == RegroupStrategy::aggregate;
+		res.push_back(step1);
 	}
-	addKeyframe(begin,
-	    next,
-	    options,
-	    strategy == RegroupStrategy::drilldown);
-
-	target = next;
+	res.push_back(PlanCache::Step{nullptr,
+	    false,
+	    strategy == RegroupStrategy::drilldown});
+	return res;
 }
 
-Gen::PlotPtr Animation::getIntermediate(Gen::PlotPtr base,
-    Gen::PlotPtr other,
-    std::function<void(Vizzu::Gen::Options &,
-        const Vizzu::Gen::Options &)> modifier)
+std::shared_ptr<const Gen::Options> Animation::getIntermediate(
+    const Gen::PlotPtr &base,
+    const Gen::PlotPtr &other,
+    const Modifier &modifier)
 {
-	Gen::PlotPtr res;
-
 	auto extOptions =
 	    std::make_shared<Gen::Options>(*base->getOptions());
 
 	modifier(*extOptions, *other->getOptions());
 
 	if (*extOptions != *other->getOptions()
-	    && *extOptions != *base->getOptions()) {
-		res = std::make_shared<Gen::Plot>(base->getTable(),
-		    extOptions,
-		    base->getStyle(),
-		    false);
+	    && *extOptions != *base->getOptions())
+		return extOptions;
+
+	return {};
+}
+
+void Animation::play(const PlanCache::Plan &plan,
+    const Gen::PlotPtr &next,
+    const Options::Keyframe &options,
+    bool reversed)
+{
+	auto from = reversed ? std::make_shared<Gen::Plot>(*next) : target;
+	auto to = reversed ? target : next;
 
-		res->keepAspectRatio = base->keepAspectRatio;
+	std::vector<std::shared_ptr<Keyframe>> keyframes;
+	auto begin = from;
+	for (const auto &step : plan) {
+		auto end = to;
+		if (step.intermediate) {
+			const auto &base = step.onSource ? from : to;
+			end = std::make_shared<Gen::Plot>(base->getTable(),
+			    std::make_shared<Gen::Options>(*step.intermediate),
+			    base->getStyle(),
+			    false);
+			end->keepAspectRatio = base->keepAspectRatio;
+		}
+		keyframes.push_back(
+		    createKeyframe(begin, end, options, step.canBeInstant));
+		begin = end;
 	}
-	return res;
+
+	if (reversed)
+		for (auto it = keyframes.rbegin(); it != keyframes.rend(); ++it)
+			::Anim::Sequence::addKeyframe(
+			    std::make_shared<ReversedKeyframe>(*it));
+	else
+		for (const auto &keyframe : keyframes)
+			::Anim::Sequence::addKeyframe(keyframe);
 }
 
-void Animation::addKeyframe(Gen::PlotPtr source,
+std::shared_ptr<Keyframe> Animation::createKeyframe(
+    Gen::PlotPtr source,
     Gen::PlotPtr target,
     const Options::Keyframe &options,
     bool canBeInstant)
@@ -176,7 +219,32 @@ void Animation::addKeyframe(Gen::PlotPtr source,
 	                *target->getOptions())
 	        ? instant
 	        : options);
-	::Anim::Sequence::addKeyframe(keyframe);
+	keyframe->setWorkerPool(workerPool);
+	keyframe->setBakeCache(bakeCache);
+	planned.push_back(keyframe);
+	return keyframe;
+}
+
+void Animation::setWorkerPool(std::shared_ptr<Util::WorkerPool> pool)
+{
+	workerPool = std::move(pool);
+}
+
+void Animation::setBakeCache(std::shared_ptr<BakeCache> cache)
+{
+	bakeCache = std::move(cache);
+	for (const auto &keyframe : planned)
+		keyframe->setBakeCache(bakeCache);
+}
+
+void Animation::setPlanCache(std::shared_ptr<PlanCache> cache)
+{
+	planCache = std::move(cache);
+}
+
+void Animation::bake()
+{
+	for (const auto &keyframe : planned) keyframe->bake();
 }
 
 void Animation::animate(const Options::Control &options,
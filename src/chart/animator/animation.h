@@ -3,9 +3,12 @@
 
 #include "base/anim/control.h"
 #include "base/anim/sequence.h"
+#include "base/util/workerpool.h"
 #include "chart/generator/plot.h"
 
+#include "bakedframes.h"
 #include "options.h"
+#include "plancache.h"
 
 namespace Vizzu
 {
@@ -18,6 +21,7 @@ public:
 	typedef std::function<void(Gen::PlotPtr, bool)> OnComplete;
 
 	Util::Event<Gen::PlotPtr> onPlotChanged;
+	Util::Event<> onProgress;
 
 	Animation(const Gen::PlotPtr &plot);
 
@@ -26,6 +30,10 @@ public:
 
 	void animate(const Options::Control &options,
 	    OnComplete onThisCompletes = OnComplete());
+	void setWorkerPool(std::shared_ptr<Util::WorkerPool> pool);
+	void setBakeCache(std::shared_ptr<BakeCache> cache);
+	void setPlanCache(std::shared_ptr<PlanCache> cache);
+	void bake();
 
 private:
 	typedef std::function<void(Vizzu::Gen::Options &,
@@ -35,16 +43,29 @@ private:
 	OnComplete completionCallback;
 	Gen::PlotPtr source;
 	Gen::PlotPtr target;
+	std::shared_ptr<Util::WorkerPool> workerPool;
+	std::shared_ptr<BakeCache> bakeCache;
+	std::shared_ptr<PlanCache> planCache;
+	std::vector<std::shared_ptr<Keyframe>> planned;
 	void finish(bool ok);
 
-	Gen::PlotPtr getIntermediate(Gen::PlotPtr base,
-	    Gen::PlotPtr other,
-	    Modifier modifier);
+	PlanCache::Plan plan(const Gen::PlotPtr &next,
+	    const Options::Keyframe &options) const;
 
-	void addKeyframe(Gen::PlotPtr source,
+	static std::shared_ptr<const Gen::Options> getIntermediate(
+	    const Gen::PlotPtr &base,
+	    const Gen::PlotPtr &other,
+	    const Modifier &modifier);
+
+	void play(const PlanCache::Plan &plan,
+	    const Gen::PlotPtr &next,
+	    const Options::Keyframe &options,
+	    bool reversed = false);
+
+	std::shared_ptr<Keyframe> createKeyframe(Gen::PlotPtr source,
 	    Gen::PlotPtr target,
 	    const Options::Keyframe &options,
-	    bool canBeInstant = false);
+	    bool canBeInstant);
 };
 
 typedef std::shared_ptr<Animation> AnimationPtr;
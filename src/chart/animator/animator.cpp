@@ -34,6 +34,9 @@ void Animator::animate(const Options::Control &options,
 	    [=, this](Gen::PlotPtr plot, bool ok)
 	{
 		nextAnimation = std::make_shared<Animation>(plot);
+		nextAnimation->setWorkerPool(workerPool);
+		nextAnimation->setBakeCache(bakeCache);
+		nextAnimation->setPlanCache(planCache);
 		this->running = false;
 		onThisCompletes(plot, ok);
 	};
@@ -46,12 +49,35 @@ void Animator::animate(const Options::Control &options,
 	actAnimation->animate(options, completionCallback);
 }
 
+void Animator::setWorkerPool(std::shared_ptr<Util::WorkerPool> pool)
+{
+	workerPool = std::move(pool);
+	if (nextAnimation) nextAnimation->setWorkerPool(workerPool);
+}
+
+void Animator::setBakeCache(std::shared_ptr<BakeCache> cache)
+{
+	bakeCache = std::move(cache);
+	if (nextAnimation) nextAnimation->setBakeCache(bakeCache);
+}
+
+void Animator::setPlanCache(std::shared_ptr<PlanCache> cache)
+{
+	planCache = std::move(cache);
+	if (nextAnimation) nextAnimation->setPlanCache(planCache);
+}
+
 void Animator::setupActAnimation()
 {
+	actAnimation->onProgress.attach(
+	    [&]
+	    {
+		    onProgress();
+	    });
+
 	actAnimation->onPlotChanged.attach(
 	    [&](const Gen::PlotPtr &actual)
 	    {
-		    onProgress();
 		    onDraw(actual);
 	    });
 
@@ -61,6 +87,7 @@ void Animator::setupActAnimation()
 
 void Animator::stripActAnimation()
 {
+	actAnimation->onProgress.detachAll();
 	actAnimation->onPlotChanged.detachAll();
 	actAnimation->onBegin.detachAll();
 	actAnimation->onComplete.detachAll();
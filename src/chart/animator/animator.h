@@ -29,6 +29,9 @@ public:
 	void animate(const Options::Control &plot = Options::Control(),
 	    Animation::OnComplete onThisCompletes =
 	        Animation::OnComplete());
+	void setWorkerPool(std::shared_ptr<Util::WorkerPool> pool);
+	void setBakeCache(std::shared_ptr<BakeCache> cache);
+	void setPlanCache(std::shared_ptr<PlanCache> cache);
 
 	Util::Event<Gen::PlotPtr> onDraw;
 	Util::Event<> onProgress;
@@ -42,6 +45,9 @@ private:
 	bool running;
 	AnimationPtr actAnimation;
 	AnimationPtr nextAnimation;
+	std::shared_ptr<Util::WorkerPool> workerPool;
+	std::shared_ptr<BakeCache> bakeCache;
+	std::shared_ptr<PlanCache> planCache;
 	void stripActAnimation();
 	void setupActAnimation();
 };
@@ -0,0 +1,149 @@
+#include "bakedframes.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "planner.h"
+
+using namespace Vizzu;
+using namespace Vizzu::Anim;
+
+namespace
+{
+
+uint16_t quantize(double value)
+{
+	return static_cast<uint16_t>(
+	    std::lround(std::clamp(value, 0.0, 1.0) * 65535.0));
+}
+
+double blend(uint16_t a, uint16_t b, double factor)
+{
+	return (a + (b - a) * factor) / 65535.0;
+}
+
+double blend(float a, float b, double factor)
+{
+	return a + (static_cast<double>(b) - a) * factor;
+}
+
+}
+
+size_t BakedFrames::frameCount() const
+{
+	return markerCount == 0 ? 0 : records.size() / markerCount;
+}
+
+void BakedFrames::clear()
+{
+	markerCount = 0;
+	records.clear();
+	records.shrink_to_fit();
+}
+
+void BakedFrames::capture(const Gen::Plot::Markers &markers)
+{
+	markerCount = markers.size();
+	for (const auto &marker : markers) {
+		records.push_back({{static_cast<float>(marker.position.x),
+		                       static_cast<float>(marker.position.y)},
+		    {static_cast<float>(marker.size.x),
+		        static_cast<float>(marker.size.y)},
+		    {static_cast<float>(marker.spacing.x),
+		        static_cast<float>(marker.spacing.y)},
+		    static_cast<float>(marker.sizeFactor),
+		    {quantize(marker.color.red),
+		        quantize(marker.color.green),
+		        quantize(marker.color.blue),
+		        quantize(marker.color.alpha)},
+		    quantize(static_cast<double>(marker.enabled)),
+		    quantize(static_cast<double>(marker.selected))});
+	}
+}
+
+void BakedFrames::restore(Gen::Plot::Markers &markers,
+    double frame) const
+{
+	auto count = frameCount();
+	if (count == 0 || markers.size() != markerCount) return;
+
+	frame = std::clamp(frame, 0.0, static_cast<double>(count - 1));
+	auto first = static_cast<size_t>(frame);
+	auto second = std::min(first + 1, count - 1);
+	auto factor = frame - static_cast<double>(first);
+
+	const auto *a = &records[first * markerCount];
+	const auto *b = &records[second * markerCount];
+
+	for (auto i = 0u; i < markerCount; i++, a++, b++) {
+		auto &marker = markers[i];
+		marker.position = Geom::Point(
+		    blend(a->position[0], b->position[0], factor),
+		    blend(a->position[1], b->position[1], factor));
+		marker.size = Geom::Point(blend(a->size[0], b->size[0], factor),
+		    blend(a->size[1], b->size[1], factor));
+		marker.spacing =
+		    Geom::Point(blend(a->spacing[0], b->spacing[0], factor),
+		        blend(a->spacing[1], b->spacing[1], factor));
+		marker.sizeFactor =
+		    blend(a->sizeFactor, b->sizeFactor, factor);
+		marker.color = Gfx::Color(blend(a->color[0], b->color[0], factor),
+		    blend(a->color[1], b->color[1], factor),
+		    blend(a->color[2], b->color[2], factor),
+		    blend(a->color[3], b->color[3], factor));
+		marker.enabled =
+		    Math::FuzzyBool(blend(a->enabled, b->enabled, factor));
+		marker.selected =
+		    Math::FuzzyBool(blend(a->selected, b->selected, factor));
+	}
+}
+
+BakeCache::BakeCache(size_t capacityBytes, double framesPerSecond) :
+    capacityBytes(capacityBytes),
+    framesPerSecond(framesPerSecond),
+    used(0)
+{}
+
+bool BakeCache::reserve(Planner &owner, size_t bytes)
+{
+	release(owner);
+
+	if (bytes > capacityBytes) return false;
+
+	while (used + bytes > capacityBytes && !entries.empty()) {
+		auto victim = entries.back();
+		entries.pop_back();
+		used -= victim.bytes;
+		victim.owner->dropBakedFrames();
+	}
+
+	entries.push_front({&owner, bytes});
+	used += bytes;
+	return true;
+}
+
+void BakeCache::touch(Planner &owner)
+{
+	auto it = find(owner);
+	if (it != entries.end())
+		entries.splice(entries.begin(), entries, it);
+}
+
+void BakeCache::release(Planner &owner)
+{
+	auto it = find(owner);
+	if (it != entries.end()) {
+		used -= it->bytes;
+		entries.erase(it);
+	}
+}
+
+std::list<BakeCache::Entry>::iterator BakeCache::find(Planner &owner)
+{
+	return std::find_if(entries.begin(),
+	    entries.end(),
+	    [&](const Entry &entry)
+	    {
+		    return entry.owner == &owner;
+	    });
+}
@@ -0,0 +1,93 @@
+#ifndef CHART_ANIM_BAKEDFRAMES_H
+#define CHART_ANIM_BAKEDFRAMES_H
+
+#include <cstdint>
+#include <list>
+#include <vector>
+
+#include "chart/generator/plot.h"
+
+namespace Vizzu
+{
+namespace Anim
+{
+
+class Planner;
+
+/**
+ * Marker geometry and colors of a keyframe sampled at a fixed frame
+ * rate. Geometry is kept in single precision, colors and fuzzy flags
+ * in 16 bit fixed point.
+ */
+class BakedFrames
+{
+public:
+	struct Record
+	{
+		float position[2];
+		float size[2];
+		float spacing[2];
+		float sizeFactor;
+		uint16_t color[4];
+		uint16_t enabled;
+		uint16_t selected;
+	};
+
+	static size_t frameBytes(size_t markerCount)
+	{
+		return markerCount * sizeof(Record);
+	}
+
+	bool empty() const { return records.empty(); }
+	size_t frameCount() const;
+	size_t bytes() const { return records.size() * sizeof(Record); }
+	void clear();
+
+	void capture(const Gen::Plot::Markers &markers);
+	void restore(Gen::Plot::Markers &markers, double frame) const;
+
+private:
+	size_t markerCount{};
+	std::vector<Record> records;
+};
+
+/**
+ * Shared byte budget of the baked frames of several keyframes. When a
+ * new bake does not fit, the least recently seeked keyframes lose
+ * their frames first.
+ */
+class BakeCache
+{
+public:
+	explicit BakeCache(size_t capacityBytes,
+	    double framesPerSecond = 30.0);
+	BakeCache(const BakeCache &) = delete;
+	BakeCache &operator=(const BakeCache &) = delete;
+
+	double getFrameRate() const { return framesPerSecond; }
+	size_t getCapacity() const { return capacityBytes; }
+	size_t usedBytes() const { return used; }
+
+	bool reserve(Planner &owner, size_t bytes);
+	void touch(Planner &owner);
+	void release(Planner &owner);
+
+private:
+	struct Entry
+	{
+		Planner *owner;
+		size_t bytes;
+	};
+
+	size_t capacityBytes;
+	double framesPerSecond;
+	size_t used;
+	std::list<Entry> entries;
+
+	std::list<Entry>::iterator find(Planner &owner);
+};
+
+}
+}
+
+#endif
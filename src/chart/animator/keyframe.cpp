@@ -1,5 +1,9 @@
 #include "keyframe.h"
 
+#include <algorithm>
+#include <iterator>
+#include <utility>
+
 using namespace Vizzu;
 using namespace Vizzu::Anim;
 
@@ -45,15 +49,7 @@ void Keyframe::prepareActual()
 	}
 	else {
 		copyTarget();
-		/*
-		        auto sourceSize = source->getMarkers().size();
-		        for (auto &markerInfo: target->markersInfo)
-		            markerInfo.second.values[0].value.markerId +=
-		   sourceSize;
-		*/
-		target->prependMarkers(*source, false);
-		source->appendMarkers(*targetCopy, false);
-
+		mergeMarkers();
 		prepareActualMarkersInfo();
 	}
 
@@ -62,13 +58,13 @@ void Keyframe::prepareActual()
 
 	actual = std::make_shared<Gen::Plot>(options, *source);
 
-	actual->markers = source->getMarkers();
-	actual->markersInfo = source->getMarkersInfo();
+	actual->markers = source->markers;
+	actual->markersInfo = source->markersInfo;
 }
 
 void Keyframe::prepareActualMarkersInfo()
 {
-	auto &origTMI = target->getMarkersInfo();
+	const auto &origTMI = std::as_const(*target).getMarkersInfo();
 	auto &smi = source->getMarkersInfo();
 	for (auto &item : smi) {
 		auto iter = origTMI.find(item.first);
@@ -93,25 +89,143 @@ void Keyframe::prepareActualMarkersInfo()
 	}
 }
 
+void Keyframe::mergeMarkers()
+{
+	const auto &sourceMarkers = std::as_const(*source).getMarkers();
+	const auto &targetMarkers = std::as_const(*targetCopy).getMarkers();
+	auto matches = matchMarkers(*source, *targetCopy);
+
+	auto size = sourceMarkers.size();
+	std::vector<size_t> positions(targetMarkers.size());
+	for (auto i = 0u; i < positions.size(); i++)
+		positions[i] = matches[i] != noMatch ? matches[i] : size++;
+
+	Gen::Plot::Markers merged(sourceMarkers);
+	merged.reserve(size);
+	for (auto &marker : merged) marker.enabled = false;
+
+	auto &markers = source->markers.write();
+	markers.reserve(size);
+
+	for (auto i = 0u; i < targetMarkers.size(); i++) {
+		auto marker = targetMarkers[i];
+		marker.remapIds(positions);
+
+		if (matches[i] != noMatch) {
+			merged[positions[i]] = marker;
+		}
+		else {
+			merged.push_back(marker);
+			marker.enabled = false;
+			markers.push_back(marker);
+		}
+	}
+
+	target->markers = std::move(merged);
+}
+
+std::vector<size_t> Keyframe::matchMarkers(const Gen::Plot &source,
+    const Gen::Plot &target)
+{
+	std::vector<size_t> matches(target.getMarkers().size(), noMatch);
+
+	auto sourceDims = source.getOptions()->getChannels().getDimensions();
+	auto targetDims = target.getOptions()->getChannels().getDimensions();
+
+	Data::DataCubeOptions::IndexSet shared;
+	std::set_intersection(sourceDims.begin(),
+	    sourceDims.end(),
+	    targetDims.begin(),
+	    targetDims.end(),
+	    std::inserter(shared, shared.begin()));
+
+	if (shared.empty()) return matches;
+
+	auto sourceKeys = collectMatchKeys(source, shared);
+	const auto &markers = target.getMarkers();
+
+	for (auto i = 0u; i < markers.size(); i++) {
+		auto key = matchKey(markers[i], targetDims, shared);
+		if (!key) continue;
+
+		auto it = sourceKeys.find(*key);
+		if (it == sourceKeys.end()) continue;
+
+		matches[i] = it->second;
+		sourceKeys.erase(it);
+	}
+	return matches;
+}
+
+Keyframe::MatchKeys Keyframe::collectMatchKeys(const Gen::Plot &plot,
+    const Data::DataCubeOptions::IndexSet &shared)
+{
+	auto dims = plot.getOptions()->getChannels().getDimensions();
+	const auto &markers = plot.getMarkers();
+
+	MatchKeys keys;
+	keys.reserve(markers.size());
+
+	for (auto i = 0u; i < markers.size(); i++)
+		if (auto key = matchKey(markers[i], dims, shared))
+			keys.emplace(std::move(*key), i);
+
+	return keys;
+}
+
+std::optional<Keyframe::MatchKey> Keyframe::matchKey(
+    const Gen::Marker &marker,
+    const Data::DataCubeOptions::IndexSet &dims,
+    const Data::DataCubeOptions::IndexSet &shared)
+{
+	if (!marker.enabled) return std::nullopt;
+
+	const auto &categories = marker.cellInfo.categories;
+
+	auto native = categories.size() == dims.size();
+	for (const auto &category : categories)
+		native = native && dims.contains(category.first);
+
+	if (!native) return std::nullopt;
+
+	auto sorted = categories;
+	std::sort(sorted.begin(), sorted.end());
+
+	MatchKey key;
+	for (const auto &[series, value] : sorted)
+		if (shared.contains(series)) key.push_back(value);
+	return key;
+}
+
+size_t Keyframe::MatchKeyHash::operator()(const MatchKey &key) const
+{
+	size_t hash = key.size();
+	for (auto value : key)
+		hash ^= std::hash<uint64_t>{}(value) + (hash << 6) + (hash >> 2);
+	return hash;
+}
+
 void Keyframe::addMissingMarkers(Gen::PlotPtr source,
     Gen::PlotPtr target,
     bool withTargetCopying)
 {
-	for (auto i = source->getMarkers().size();
-	     i < target->getMarkers().size();
-	     i++) {
-		auto src = target->getMarkers()[i];
+	const auto &sourceMarkers = std::as_const(*source).getMarkers();
+	const auto &targetMarkers = std::as_const(*target).getMarkers();
+
+	for (auto i = sourceMarkers.size(); i < targetMarkers.size(); i++) {
+		auto src = targetMarkers[i];
 		src.enabled = false;
-		source->markers.push_back(src);
+		source->markers.write().push_back(src);
 	}
 
-	for (auto i = target->getMarkers().size();
-	     i < source->getMarkers().size();
-	     i++) {
-		if (withTargetCopying) copyTarget();
-		auto trg = source->getMarkers()[i];
+	for (auto i = targetMarkers.size(); i < sourceMarkers.size(); i++) {
+		if (withTargetCopying) {
+			copyTarget();
+			target = this->target;
+		}
+		auto trg = sourceMarkers[i];
 		trg.enabled = false;
-		target->markers.push_back(trg);
+		target->markers.write().push_back(trg);
 	}
 }
 
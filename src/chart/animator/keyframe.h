@@ -2,6 +2,9 @@
 #define KEYFRAME_H
 
 #include <memory>
+#include <optional>
+#include <unordered_map>
+#include <vector>
 
 #include "chart/generator/plot.h"
 
@@ -23,6 +26,18 @@ public:
 	[[nodiscard]] std::shared_ptr<void> data() const { return actual; }
 
 private:
+	typedef std::vector<uint64_t> MatchKey;
+
+	struct MatchKeyHash
+	{
+		size_t operator()(const MatchKey &key) const;
+	};
+
+	typedef std::unordered_map<MatchKey, size_t, MatchKeyHash>
+	    MatchKeys;
+
+	static constexpr size_t noMatch = static_cast<size_t>(-1);
+
 	Options::Keyframe options;
 	Gen::PlotPtr source;
 	Gen::PlotPtr target;
@@ -32,6 +47,19 @@ private:
 	void init(Gen::PlotPtr plot);
 	void prepareActual();
 	void prepareActualMarkersInfo();
+	void mergeMarkers();
+	/** Source marker for each target marker with the same categories
+	 *  of the shared dimensions. A source marker morphs into the first
+	 *  target marker with its categories; the others fade in. */
+	static std::vector<size_t> matchMarkers(const Gen::Plot &source,
+	    const Gen::Plot &target);
+	/** Keys of the markers of the plot, each mapped to the first
+	 *  marker having it. */
+	static MatchKeys collectMatchKeys(const Gen::Plot &plot,
+	    const Data::DataCubeOptions::IndexSet &shared);
+	static std::optional<MatchKey> matchKey(const Gen::Marker &marker,
+	    const Data::DataCubeOptions::IndexSet &dims,
+	    const Data::DataCubeOptions::IndexSet &shared);
 	void addMissingMarkers(Gen::PlotPtr source,
 	    Gen::PlotPtr target,
 	    bool withTargetCopying);
@@ -1,5 +1,7 @@
 #include "morph.h"
 
+#include <limits>
+
 #include "base/math/interpolation.h"
 
 using namespace Vizzu;
@@ -46,23 +48,6 @@ std::unique_ptr<AbstractMorph> AbstractMorph::create(
 	}
 }
 
-void AbstractMorph::transform(double factor)
-{
-	transform(source, target, actual, factor);
-
-	transform(*source.getOptions(),
-	    *target.getOptions(),
-	    *actual.options,
-	    factor);
-
-	for (auto i = 0u; i < source.getMarkers().size(); i++) {
-		transform(source.getMarkers()[i],
-		    target.getMarkers()[i],
-		    actual.markers[i],
-		    factor);
-	}
-}
-
 void CoordinateSystem::transform(const Gen::Options &source,
     const Gen::Options &target,
     Gen::Options &actual,
@@ -165,18 +150,20 @@ void Connection::transform(const Gen::Options &source,
 	}
 }
 
-void Connection::transform(
-	const Marker &source,
-	const Marker &target,
-	Marker &actual,
-	double factor) const
+void Connection::transform(const Marker &source,
+    const Marker &target,
+    Marker &actual,
+    double factor) const
 {
-	actual.prevMainMarkerIdx =
-	    interpolate(source.prevMainMarkerIdx,
-	        target.prevMainMarkerIdx,
-	        factor);
+	::Anim::interpolateInto(actual.prevMainMarkerIdx,
+	    source.prevMainMarkerIdx,
+	    target.prevMainMarkerIdx,
+	    factor);
 
-	actual.mainId = interpolate(source.mainId, target.mainId, factor);
+	::Anim::interpolateInto(actual.mainId,
+	    source.mainId,
+	    target.mainId,
+	    factor);
 }
 
 void Vertical::transform(const Plot &source,
@@ -220,7 +207,18 @@ void Vertical::transform(const Marker &source,
 	    interpolate(source.spacing.y, target.spacing.y, factor);
 	actual.sizeFactor =
 	    interpolate(source.sizeFactor, target.sizeFactor, factor);
-	actual.label = interpolate(source.label, target.label, factor);
+	transformLabel(source, target, actual, factor);
+}
+
+void Vertical::transformLabel(const Marker &source,
+    const Marker &target,
+    Marker &actual,
+    double factor) const
+{
+	::Anim::interpolateInto(actual.label,
+	    source.label,
+	    target.label,
+	    factor);
 }
 
 void Morph::Color::transform(const Plot &source,
@@ -261,3 +259,168 @@ void Morph::Color::transform(const Marker &source,
 	actual.selected =
 	    interpolate(source.selected, target.selected, factor);
 }
+
+class Executor::Section : public ::Anim::IElement
+{
+public:
+	Section(Executor &executor, size_t index) :
+	    executor(executor),
+	    index(index)
+	{}
+
+	void transform(double factor) override
+	{
+		executor.entries[index].factor = factor;
+	}
+
+private:
+	Executor &executor;
+	size_t index;
+};
+
+std::unique_ptr<::Anim::IElement> Executor::add(SectionId sectionId,
+    const Plot &source,
+    const Plot &target,
+    Plot &actual)
+{
+	this->source = &source;
+	this->target = &target;
+	this->actual = &actual;
+
+	entries.push_back({sectionId,
+	    AbstractMorph::create(sectionId, source, target, actual),
+	    0.0,
+	    std::numeric_limits<double>::quiet_NaN()});
+
+	return std::make_unique<Section>(*this, entries.size() - 1);
+}
+
+void Executor::clear()
+{
+	entries.clear();
+	active.clear();
+}
+
+void Executor::execute()
+{
+	if (applySections(false)) transformMarkers(false);
+}
+
+void Executor::execute(const BakedFrames &frames, double frame)
+{
+	auto anyResidual = applySections(true);
+	frames.restore(actual->getMarkers(), frame);
+	if (anyResidual) transformMarkers(true);
+}
+
+bool Executor::applySections(bool baked)
+{
+	active.clear();
+
+	for (auto &entry : entries) {
+		if (entry.factor == entry.applied) continue;
+		entry.applied = entry.factor;
+
+		const auto &morph = *entry.morph;
+		morph.transform(*source, *target, *actual, entry.factor);
+		morph.transform(*source->getOptions(),
+		    *target->getOptions(),
+		    *actual->getOptions(),
+		    entry.factor);
+
+		if (!morph.transformsMarkers()) continue;
+
+		if (!baked || entry.sectionId == SectionId::y
+		    || entry.sectionId == SectionId::connection)
+			active.push_back(&entry);
+	}
+
+	return !active.empty();
+}
+
+void Executor::transformMarkers(bool baked)
+{
+	const auto &sourceMarkers = source->getMarkers();
+	const auto &targetMarkers = target->getMarkers();
+	auto &actualMarkers = actual->getMarkers();
+
+	auto transformRange = [&](size_t begin, size_t end)
+	{
+		for (auto i = begin; i < end; i++)
+			for (const auto *entry : active)
+				transformMarker(*entry,
+				    baked,
+				    sourceMarkers[i],
+				    targetMarkers[i],
+				    actualMarkers[i]);
+	};
+
+	if (workerPool)
+		workerPool->forEach(sourceMarkers.size(),
+		    parallelChunkSize,
+		    transformRange);
+	else
+		transformRange(0, sourceMarkers.size());
+}
+
+void Executor::setWorkerPool(std::shared_ptr<Util::WorkerPool> pool)
+{
+	workerPool = std::move(pool);
+}
+
+void Executor::transformMarker(const Entry &entry,
+    bool baked,
+    const Marker &source,
+    const Marker &target,
+    Marker &actual)
+{
+	const auto &morph = *entry.morph;
+	auto factor = entry.factor;
+
+	switch (entry.sectionId) {
+	case SectionId::show:
+		static_cast<const Show &>(morph).Show::transform(source,
+		    target,
+		    actual,
+		    factor);
+		break;
+	case SectionId::hide:
+		static_cast<const Hide &>(morph).Hide::transform(source,
+		    target,
+		    actual,
+		    factor);
+		break;
+	case SectionId::x:
+		static_cast<const Horizontal &>(morph).Horizontal::transform(
+		    source,
+		    target,
+		    actual,
+		    factor);
+		break;
+	case SectionId::y:
+		if (baked)
+			static_cast<const Vertical &>(morph).transformLabel(source,
+			    target,
+			    actual,
+			    factor);
+		else
+			static_cast<const Vertical &>(morph).Vertical::transform(
+			    source,
+			    target,
+			    actual,
+			    factor);
+		break;
+	case SectionId::color:
+		static_cast<const Morph::Color &>(morph)
+		    .Morph::Color::transform(source, target, actual, factor);
+		break;
+	case SectionId::connection:
+		static_cast<const Connection &>(morph).Connection::transform(
+		    source,
+		    target,
+		    actual,
+		    factor);
+		break;
+	default: morph.transform(source, target, actual, factor);
+	}
+}
@@ -2,13 +2,16 @@
 #define MORPH_H
 
 #include <memory>
+#include <vector>
 
 #include "base/anim/element.h"
 #include "base/math/interpolation.h"
 #include "base/math/ratio.h"
+#include "base/util/workerpool.h"
 #include "chart/generator/plot.h"
 #include "chart/options/options.h"
 
+#include "bakedframes.h"
 #include "options.h"
 
 namespace Vizzu
@@ -18,7 +21,7 @@ namespace Anim
 namespace Morph
 {
 
-class AbstractMorph : public ::Anim::IElement
+class AbstractMorph
 {
 protected:
 	typedef Gen::Plot Dia;
@@ -33,7 +36,6 @@ public:
 	    const Dia &source,
 	    const Dia &target,
 	    Dia &actual);
-	void transform(double factor) override;
 	virtual void
 	transform(const Dia &, const Dia &, Dia &, double) const
 	{}
@@ -43,6 +45,7 @@ public:
 	virtual void
 	transform(const Marker &, const Marker &, Marker &, double) const
 	{}
+	virtual bool transformsMarkers() const { return true; }
 
 protected:
 	const Dia &source;
@@ -50,14 +53,15 @@ protected:
 	Dia &actual;
 };
 
-class CoordinateSystem : public AbstractMorph
+class CoordinateSystem final : public AbstractMorph
 {
 public:
 	using AbstractMorph::AbstractMorph;
 	void transform(const Opt &, const Opt &, Opt &, double) const override;
+	bool transformsMarkers() const override { return false; }
 };
 
-class Show : public AbstractMorph
+class Show final : public AbstractMorph
 {
 public:
 	using AbstractMorph::AbstractMorph;
@@ -67,7 +71,7 @@ public:
 	    double) const override;
 };
 
-class Hide : public AbstractMorph
+class Hide final : public AbstractMorph
 {
 public:
 	using AbstractMorph::AbstractMorph;
@@ -77,15 +81,16 @@ public:
 	    double) const override;
 };
 
-class Shape : public AbstractMorph
+class Shape final : public AbstractMorph
 {
 public:
 	using AbstractMorph::AbstractMorph;
 	void
 	transform(const Opt &, const Opt &, Opt &, double) const override;
+	bool transformsMarkers() const override { return false; }
 };
 
-class Horizontal : public AbstractMorph
+class Horizontal final : public AbstractMorph
 {
 public:
 	using AbstractMorph::AbstractMorph;
@@ -97,15 +102,19 @@ public:
 	    double) const override;
 };
 
-class Connection : public AbstractMorph
+class Connection final : public AbstractMorph
 {
 public:
 	using AbstractMorph::AbstractMorph;
-	void transform(const Opt&, const Opt&, Opt&, double) const override;
-	void transform(const Marker&, const Marker&, Marker&, double) const override;
+	void
+	transform(const Opt &, const Opt &, Opt &, double) const override;
+	void transform(const Marker &,
+	    const Marker &,
+	    Marker &,
+	    double) const override;
 };
 
-class Vertical : public AbstractMorph
+class Vertical final : public AbstractMorph
 {
 public:
 	using AbstractMorph::AbstractMorph;
@@ -115,9 +124,13 @@ public:
 	    const Marker &,
 	    Marker &,
 	    double) const override;
+	void transformLabel(const Marker &,
+	    const Marker &,
+	    Marker &,
+	    double) const;
 };
 
-class Color : public AbstractMorph
+class Color final : public AbstractMorph
 {
 public:
 	using AbstractMorph::AbstractMorph;
@@ -129,6 +142,59 @@ public:
 	    double) const override;
 };
 
+/**
+ * Evaluates all morph sections of a keyframe together: every frame
+ * the plot and option level transforms of the changed sections run
+ * once, then a single sweep over the markers applies their marker
+ * transforms. Sections whose factor did not change since the last
+ * evaluation are skipped. With a worker pool set, large marker sweeps
+ * are split between its threads; every marker only depends on its own
+ * source, target and actual slot, so the result equals the serial one.
+ * From baked frames only the non-numeric marker state (labels and
+ * connection ids) is still interpolated per marker.
+ */
+class Executor
+{
+public:
+	std::unique_ptr<::Anim::IElement> add(SectionId sectionId,
+	    const Gen::Plot &source,
+	    const Gen::Plot &target,
+	    Gen::Plot &actual);
+	void clear();
+	void execute();
+	void execute(const BakedFrames &frames, double frame);
+	void setWorkerPool(std::shared_ptr<Util::WorkerPool> pool);
+
+private:
+	static constexpr size_t parallelChunkSize = 1024;
+
+	class Section;
+
+	struct Entry
+	{
+		SectionId sectionId;
+		std::unique_ptr<AbstractMorph> morph;
+		double factor;
+		double applied;
+	};
+
+	const Gen::Plot *source{};
+	const Gen::Plot *target{};
+	Gen::Plot *actual{};
+	std::shared_ptr<Util::WorkerPool> workerPool;
+	std::vector<Entry> entries;
+	std::vector<const Entry *> active;
+
+	bool applySections(bool baked);
+	void transformMarkers(bool baked);
+
+	static void transformMarker(const Entry &entry,
+	    bool baked,
+	    const Gen::Marker &source,
+	    const Gen::Marker &target,
+	    Gen::Marker &actual);
+};
+
 }
 }
 }
@@ -40,6 +40,7 @@ public:
 		std::optional<::Anim::Duration> duration;
 		void set(const std::string &param, const std::string &value);
 		bool isSet() const;
+		bool operator==(const Section &) const = default;
 	};
 
 	struct Keyframe
@@ -50,6 +51,7 @@ public:
 		Section &get(SectionId sectionId);
 		const Section &get(SectionId sectionId) const;
 		RegroupStrategy getRegroupStrategy() const;
+		bool operator==(const Keyframe &) const = default;
 	};
 
 	struct Control
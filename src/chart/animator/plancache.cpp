@@ -0,0 +1,77 @@
+#include "plancache.h"
+
+using namespace Vizzu;
+using namespace Vizzu::Anim;
+
+ReversedKeyframe::ReversedKeyframe(std::shared_ptr<Keyframe> keyframe) :
+    keyframe(std::move(keyframe))
+{
+	duration = this->keyframe->getDuration();
+}
+
+void ReversedKeyframe::setPosition(::Anim::Duration progress)
+{
+	::Anim::Controllable &controlled = *keyframe;
+	controlled.setPosition(duration - progress);
+	dirty = controlled.isDirty();
+}
+
+std::shared_ptr<void> ReversedKeyframe::data() const
+{
+	return keyframe->data();
+}
+
+PlanCache::Key::PlotId::PlotId(const Gen::Plot &plot) :
+    id(plot.getId()),
+    markers(plot.shareMarkers())
+{}
+
+bool PlanCache::Key::PlotId::operator==(const PlotId &other) const
+{
+	return id == other.id && markers.sharesWith(other.markers);
+}
+
+PlanCache::Key::Key(const Gen::Plot &source,
+    const Gen::Plot &target,
+    const Options::Keyframe &options) :
+    source(source),
+    target(target),
+    options(options)
+{}
+
+bool PlanCache::Key::forward(const Key &other) const
+{
+	return options == other.options && source == other.source
+	    && target == other.target;
+}
+
+bool PlanCache::Key::backward(const Key &other) const
+{
+	return options == other.options && source == other.target
+	    && target == other.source;
+}
+
+PlanCache::PlanCache(size_t capacity) : capacity(capacity) {}
+
+PlanCache::Hit PlanCache::get(const Key &key)
+{
+	for (auto it = entries.begin(); it != entries.end(); ++it) {
+		auto backward = key.backward(it->key);
+
+		if (backward || key.forward(it->key)) {
+			entries.splice(entries.begin(), entries, it);
+			return {it->plan, backward};
+		}
+	}
+	return {};
+}
+
+void PlanCache::add(Key key, Plan plan)
+{
+	if (capacity == 0 || plan.empty()) return;
+
+	entries.push_front(Entry{std::move(key), std::move(plan)});
+	if (entries.size() > capacity) entries.pop_back();
+}
+
+void PlanCache::clear() { entries.clear(); }
@@ -0,0 +1,122 @@
+#ifndef CHART_ANIM_PLANCACHE
+#define CHART_ANIM_PLANCACHE
+
+#include <list>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "base/anim/controllable.h"
+#include "base/type/copyonwrite.h"
+#include "chart/generator/plot.h"
+
+#include "keyframe.h"
+#include "options.h"
+
+namespace Vizzu
+{
+namespace Anim
+{
+
+/**
+ * Plays a keyframe backwards, for serving a plan in the opposite
+ * direction of the transition it was made for.
+ */
+class ReversedKeyframe : public ::Anim::Controllable
+{
+public:
+	explicit ReversedKeyframe(std::shared_ptr<Keyframe> keyframe);
+
+	void setPosition(::Anim::Duration progress) override;
+	std::shared_ptr<void> data() const override;
+
+private:
+	std::shared_ptr<Keyframe> keyframe;
+};
+
+/**
+ * Keeps the plans of the most recent transitions, keyed by the
+ * identity of the source and target plots and the keyframe options.
+ * A plan records the decisions made planning a transition: the
+ * keyframes it takes and the options of the intermediate plots
+ * between them. A transition between the same plots in the opposite
+ * direction is served by the same plan played backwards.
+ * Plots are identified by their generation and by the storage of
+ * their markers, so a plot changed in place since (e.g. by a
+ * selection) is planned again. The keyframes and the intermediate
+ * plots are built anew from the plan on the plots of each animation,
+ * so animations served by the same plan share no state.
+ */
+class PlanCache
+{
+public:
+	struct Step
+	{
+		/** Options of the intermediate plot the keyframe leads to;
+		 *  null if it leads to the target of the transition. */
+		std::shared_ptr<const Gen::Options> intermediate;
+		/** The intermediate plot is based on the source of the
+		 *  transition instead of its target. */
+		bool onSource{};
+		bool canBeInstant{};
+	};
+
+	typedef std::vector<Step> Plan;
+
+	/** Identifies a transition; taken before planning, as planning
+	 *  may add markers to the plots. */
+	class Key
+	{
+	public:
+		Key(const Gen::Plot &source,
+		    const Gen::Plot &target,
+		    const Options::Keyframe &options);
+
+		bool forward(const Key &other) const;
+		bool backward(const Key &other) const;
+
+	private:
+		struct PlotId
+		{
+			uint64_t id;
+			Type::CopyOnWrite<Gen::Plot::Markers> markers;
+
+			explicit PlotId(const Gen::Plot &plot);
+			bool operator==(const PlotId &other) const;
+		};
+
+		PlotId source;
+		PlotId target;
+		Options::Keyframe options;
+	};
+
+	struct Hit
+	{
+		Plan plan;
+		bool reversed{};
+	};
+
+	explicit PlanCache(size_t capacity = 8);
+	PlanCache(const PlanCache &) = delete;
+	PlanCache &operator=(const PlanCache &) = delete;
+
+	Hit get(const Key &key);
+	void add(Key key, Plan plan);
+	void clear();
+	size_t size() const { return entries.size(); }
+
+private:
+	struct Entry
+	{
+		Key key;
+		Plan plan;
+	};
+
+	size_t capacity;
+	std::list<Entry> entries;
+};
+
+}
+}
+
+#endif
@@ -1,5 +1,8 @@
 #include "planner.h"
 
+#include <cmath>
+#include <utility>
+
 #include "base/anim/easingfunc.h"
 
 #include "morph.h"
@@ -24,7 +27,13 @@ void Planner::createPlan(const Gen::Plot &source,
 	const auto &actOpt = actual.getOptions();
 
 	reset();
-	calcNeeded();
+
+	Morph::StyleMorphFactory styles(source.getStyle(),
+	    target.getStyle(),
+	    actual.getStyle(),
+	    &actual.getStyleRevision());
+
+	calcNeeded(styles);
 
 	::Anim::Duration baseStep(1125ms);
 	::Anim::Duration step(baseStep);
@@ -83,10 +92,7 @@ void Planner::createPlan(const Gen::Plot &source,
 		addMorph(SectionId::connection, duration - getBaseline());
 
 		if (animNeeded[SectionId::style])
-			Morph::StyleMorphFactory(source.getStyle(),
-			    target.getStyle(),
-			    actual.getStyle())
-			    .populate(*this, getOptions(SectionId::style, step));
+			styles.populate(*this, getOptions(SectionId::style, step));
 
 		if (animNeeded[SectionId::legend])
 			addElement(
@@ -138,10 +144,7 @@ void Planner::createPlan(const Gen::Plot &source,
 		addMorph(SectionId::connection, step);
 
 		if (animNeeded[SectionId::style])
-			Morph::StyleMorphFactory(source.getStyle(),
-			    target.getStyle(),
-			    actual.getStyle())
-			    .populate(*this, getOptions(SectionId::style, step));
+			styles.populate(*this, getOptions(SectionId::style, step));
 
 		if (animNeeded[SectionId::legend])
 			addElement(
@@ -198,24 +201,89 @@ void Planner::reTime()
 		::Anim::Group::reTime(this->duration, *options->all.delay);
 }
 
+Planner::~Planner()
+{
+	if (bakeCache) bakeCache->release(*this);
+}
+
+void Planner::setBakeCache(std::shared_ptr<BakeCache> cache)
+{
+	if (cache == bakeCache) return;
+	if (bakeCache) bakeCache->release(*this);
+	dropBakedFrames();
+	bakeCache = std::move(cache);
+}
+
+void Planner::bake()
+{
+	if (!bakeCache || !actual || isBaked()) return;
+
+	auto seconds = duration.sec();
+	auto markerCount = std::as_const(*actual).getMarkers().size();
+	if (seconds <= 0.0 || markerCount == 0) return;
+
+	auto frames = static_cast<size_t>(
+	                  std::ceil(seconds * bakeCache->getFrameRate()))
+	            + 1;
+
+	if (!bakeCache->reserve(*this,
+	        frames * BakedFrames::frameBytes(markerCount)))
+		return;
+
+	for (auto i = 0u; i < frames; i++) {
+		::Anim::Group::setPosition(
+		    duration * (static_cast<double>(i) / (frames - 1)));
+		morphs.execute();
+		bakedFrames.capture(std::as_const(*actual).getMarkers());
+	}
+
+	apply(lastProgress);
+}
+
+void Planner::setPosition(::Anim::Duration progress)
+{
+	if (bakeCache && !isBaked() && progress < lastProgress) bake();
+
+	lastProgress = progress;
+	apply(progress);
+}
+
+void Planner::apply(::Anim::Duration progress)
+{
+	::Anim::Group::setPosition(progress);
+	if (isBaked()) bakeCache->touch(*this);
+	if (!dirty) return;
+
+	if (!isBaked()) {
+		morphs.execute();
+		return;
+	}
+
+	morphs.execute(bakedFrames,
+	    progress / duration
+	        * static_cast<double>(bakedFrames.frameCount() - 1));
+}
+
+void Planner::dropBakedFrames() { bakedFrames.clear(); }
+
 void Planner::reset()
 {
 	::Anim::Group::clear();
+	morphs.clear();
+	if (bakeCache) bakeCache->release(*this);
+	dropBakedFrames();
+	lastProgress = ::Anim::Duration(0);
 
 	for (auto i = 0u; i < std::size(animNeeded); i++)
 		animNeeded[static_cast<SectionId>(i)] = false;
 }
 
-void Planner::calcNeeded()
+void Planner::calcNeeded(const Morph::StyleMorphFactory &styles)
 {
 	const auto &srcOpt = source->getOptions();
 	const auto &trgOpt = target->getOptions();
 
-	animNeeded[SectionId::style] =
-	    Morph::StyleMorphFactory(source->getStyle(),
-	        target->getStyle(),
-	        actual->getStyle())
-	        .isNeeded();
+	animNeeded[SectionId::style] = styles.isNeeded();
 
 	animNeeded[SectionId::title] =
 	    srcOpt->title != trgOpt->title;
@@ -414,10 +482,7 @@ void Planner::addMorph(SectionId sectionId,
     std::optional<::Anim::Easing> easing)
 {
 	if (animNeeded[sectionId]) {
-		addElement(Morph::AbstractMorph::create(sectionId,
-		               *source,
-		               *target,
-		               *actual),
+		addElement(morphs.add(sectionId, *source, *target, *actual),
 		    getOptions(sectionId, duration, delay, easing));
 	}
 }
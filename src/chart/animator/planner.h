@@ -10,7 +10,10 @@
 #include "base/anim/group.h"
 #include "chart/generator/plot.h"
 
+#include "bakedframes.h"
+#include "morph.h"
 #include "options.h"
+#include "styles.h"
 
 namespace Vizzu
 {
@@ -21,24 +24,45 @@ class Planner : public ::Anim::Group
 {
 public:
 	Planner() = default;
+	Planner(const Planner &) = delete;
+	Planner &operator=(const Planner &) = delete;
+	~Planner() override;
+
+	void setWorkerPool(std::shared_ptr<Util::WorkerPool> pool)
+	{
+		morphs.setWorkerPool(std::move(pool));
+	}
+
+	void setBakeCache(std::shared_ptr<BakeCache> cache);
+	void bake();
+	bool isBaked() const { return !bakedFrames.empty(); }
 
 protected:
+	void setPosition(::Anim::Duration progress) override;
 	void createPlan(const Gen::Plot &source,
 	    const Gen::Plot &target,
 	    Gen::Plot &actual,
 	    const Options::Keyframe &options);
 
 private:
-	const Gen::Plot *source;
-	const Gen::Plot *target;
-	Gen::Plot *actual;
-	const Options::Keyframe *options;
+	friend class BakeCache;
+
+	const Gen::Plot *source{};
+	const Gen::Plot *target{};
+	Gen::Plot *actual{};
+	const Options::Keyframe *options{};
 	typedef Refl::EnumArray<SectionId, bool> AnimNeeded;
 
 	AnimNeeded animNeeded;
+	Morph::Executor morphs;
+	std::shared_ptr<BakeCache> bakeCache;
+	BakedFrames bakedFrames;
+	::Anim::Duration lastProgress;
 
+	void apply(::Anim::Duration progress);
+	void dropBakedFrames();
 	void reset();
-	void calcNeeded();
+	void calcNeeded(const Morph::StyleMorphFactory &styles);
 
 	void addMorph(SectionId sectionId,
 	    ::Anim::Duration duration,
@@ -7,74 +7,113 @@ using namespace Vizzu;
 using namespace Vizzu::Anim::Morph;
 using namespace Math;
 
-template <typename T> class StyleMorph : public ::Anim::IElement
+namespace
 {
-public:
-	StyleMorph(const T &source, const T &target, T &actual) :
-	    source(source),
-	    target(target),
-	    actual(actual)
-	{}
-
-	void transform(double factor) override
-	{
-		*actual = interpolate(*source, *target, factor);
+
+template <typename T>
+void transformParam(const std::byte *source,
+    const std::byte *target,
+    std::byte *actual,
+    double factor)
+{
+	const auto &from = *reinterpret_cast<const T *>(source);
+	const auto &to = *reinterpret_cast<const T *>(target);
+	auto &value = *reinterpret_cast<T *>(actual);
+
+	if constexpr (std::is_same_v<typename T::value_type,
+	                  Gfx::Font::Style>)
+		value = factor < 0.5 ? *from : *to;
+	else if constexpr (requires {
+		                   ::Anim::interpolateInto(*value,
+		                       *from,
+		                       *to,
+		                       factor);
+	                   }) {
+		if (value)
+			::Anim::interpolateInto(*value, *from, *to, factor);
+		else
+			value = interpolate(*from, *to, factor);
 	}
+	else
+		value = interpolate(*from, *to, factor);
+}
+
+}
 
-	const T &source;
-	const T &target;
-	T &actual;
-};
+template <typename T>
+void StyleMorph::Batch<T>::add(size_t offset,
+    const T &source,
+    const T &target)
+{
+	offsets.push_back(offset);
+	this->source.push_back(source);
+	this->target.push_back(target);
+}
 
-template <>
-class StyleMorph<Style::Param<Gfx::Font::Style>> :
-    public ::Anim::IElement
+template <typename T>
+void StyleMorph::Batch<T>::transform(std::byte *actual,
+    double factor) const
 {
-public:
-	StyleMorph(const Style::Param<Gfx::Font::Style> &source,
-	    const Style::Param<Gfx::Font::Style> &target,
-	    Style::Param<Gfx::Font::Style> &actual) :
-	    source(source),
-	    target(target),
-	    actual(actual)
-	{}
-
-	void transform(double factor) override
-	{
-		*actual = factor < 0.5 ? *source : *target;
-	}
+	for (auto i = 0u; i < offsets.size(); i++)
+		*reinterpret_cast<Style::Param<T> *>(actual + offsets[i]) =
+		    interpolate(source[i], target[i], factor);
+}
+
+StyleMorph::StyleMorph(const Styles::Chart &source,
+    const Styles::Chart &target,
+    Styles::Chart &actual,
+    Styles::Revision *revision) :
+    pSource(reinterpret_cast<const std::byte *>(&source)),
+    pTarget(reinterpret_cast<const std::byte *>(&target)),
+    pActual(reinterpret_cast<std::byte *>(&actual)),
+    revision(revision)
+{}
+
+void StyleMorph::transform(double factor)
+{
+	if (revision && factor != lastFactor) revision->bump();
+	lastFactor = factor;
+
+	numbers.transform(pActual, factor);
+	colors.transform(pActual, factor);
+	lengths.transform(pActual, factor);
 
-	const Style::Param<Gfx::Font::Style> &source;
-	const Style::Param<Gfx::Font::Style> &target;
-	Style::Param<Gfx::Font::Style> &actual;
-};
+	for (const auto &entry : others)
+		entry.transform(pSource + entry.offset,
+		    pTarget + entry.offset,
+		    pActual + entry.offset,
+		    factor);
+}
+
+bool StyleMorph::empty() const { return size() == 0; }
+
+size_t StyleMorph::size() const
+{
+	return numbers.offsets.size() + colors.offsets.size()
+	     + lengths.offsets.size() + others.size();
+}
 
 StyleMorphFactory::StyleMorphFactory(const Styles::Chart &source,
     const Styles::Chart &target,
-    Styles::Chart &actual)
+    Styles::Chart &actual,
+    Styles::Revision *revision) :
+    morph(std::make_unique<StyleMorph>(source,
+        target,
+        actual,
+        revision))
 {
-	dry = true;
-	needed = false;
-	pSource = reinterpret_cast<const std::byte *>(&source);
-	pTarget = reinterpret_cast<const std::byte *>(&target);
-	pActual = reinterpret_cast<std::byte *>(&actual);
+	actual.visit(*this);
 }
 
-bool StyleMorphFactory::isNeeded()
+bool StyleMorphFactory::isNeeded() const
 {
-	dry = true;
-	needed = false;
-	reinterpret_cast<Styles::Chart *>(pActual)->visit(*this);
-	return needed;
+	return morph && !morph->empty();
 }
 
 void StyleMorphFactory::populate(::Anim::Group &group,
     const ::Anim::Options &options)
 {
-	this->group = &group;
-	this->options = &options;
-	dry = false;
-	reinterpret_cast<Styles::Chart *>(pActual)->visit(*this);
+	if (isNeeded()) group.addElement(std::move(morph), options);
 }
 
 template <typename T>
@@ -91,23 +130,24 @@ StyleMorphFactory &StyleMorphFactory::operator()(T &value,
 	        Styles::MarkerLabel::Format>
 	    && !std::is_same_v<typename T::value_type,
 	        Gfx::ColorPalette>) {
-		auto offset = reinterpret_cast<std::byte *>(&value) - pActual;
+		auto offset = static_cast<size_t>(
+		    reinterpret_cast<std::byte *>(&value) - morph->pActual);
 		const T &source =
-		    *reinterpret_cast<const T *>(pSource + offset);
+		    *reinterpret_cast<const T *>(morph->pSource + offset);
 		const T &target =
-		    *reinterpret_cast<const T *>(pTarget + offset);
+		    *reinterpret_cast<const T *>(morph->pTarget + offset);
 
 		if (*source != *target) {
-			if (this->dry)
-				this->needed = true;
-			else {
-				auto morph = std::make_unique<StyleMorph<T>>(source,
-				    target,
-				    value);
-
-				if (group && options)
-					group->addElement(std::move(morph), *options);
-			}
+			typedef typename T::value_type Value;
+
+			if constexpr (std::is_same_v<Value, double>)
+				morph->numbers.add(offset, *source, *target);
+			else if constexpr (std::is_same_v<Value, Gfx::Color>)
+				morph->colors.add(offset, *source, *target);
+			else if constexpr (std::is_same_v<Value, Gfx::Length>)
+				morph->lengths.add(offset, *source, *target);
+			else
+				morph->others.push_back({offset, &transformParam<T>});
 		}
 	}
 	return *this;
@@ -2,9 +2,13 @@
 #define CHART_ANIM_STYLES_H
 
 #include <cstddef>
+#include <memory>
+#include <vector>
 
 #include "base/anim/element.h"
 #include "base/anim/group.h"
+#include "base/gfx/color.h"
+#include "base/gfx/length.h"
 #include "base/math/interpolation.h"
 #include "chart/main/style.h"
 
@@ -15,14 +19,70 @@ namespace Anim
 namespace Morph
 {
 
+/**
+ * Interprets the list of style parameters differing between two
+ * charts. Numbers, colors and lengths are interpolated in batches from
+ * flat arrays of their end values; other parameter types go through a
+ * type specific function stored next to their offset.
+ */
+class StyleMorph : public ::Anim::IElement
+{
+public:
+	/** Takes a new revision of the actual style whenever it changes
+	 *  the style, if a revision is given. */
+	StyleMorph(const Styles::Chart &source,
+	    const Styles::Chart &target,
+	    Styles::Chart &actual,
+	    Styles::Revision *revision = nullptr);
+
+	void transform(double factor) override;
+	bool empty() const;
+	size_t size() const;
+
+private:
+	friend class StyleMorphFactory;
+
+	template <typename T> struct Batch
+	{
+		std::vector<size_t> offsets;
+		std::vector<T> source;
+		std::vector<T> target;
+
+		void add(size_t offset, const T &source, const T &target);
+		void transform(std::byte *actual, double factor) const;
+	};
+
+	typedef void (*Transform)(const std::byte *source,
+	    const std::byte *target,
+	    std::byte *actual,
+	    double factor);
+
+	struct Entry
+	{
+		size_t offset;
+		Transform transform;
+	};
+
+	const std::byte *pSource;
+	const std::byte *pTarget;
+	std::byte *pActual;
+	Styles::Revision *revision;
+	double lastFactor{-1};
+	Batch<double> numbers;
+	Batch<Gfx::Color> colors;
+	Batch<Gfx::Length> lengths;
+	std::vector<Entry> others;
+};
+
 class StyleMorphFactory
 {
 public:
 	StyleMorphFactory(const Styles::Chart &source,
 	    const Styles::Chart &target,
-	    Styles::Chart &actual);
+	    Styles::Chart &actual,
+	    Styles::Revision *revision = nullptr);
 
-	bool isNeeded();
+	bool isNeeded() const;
 	void populate(::Anim::Group &group,
 	    const ::Anim::Options &options);
 
@@ -30,13 +90,7 @@ public:
 	StyleMorphFactory &operator()(T &value, const char *);
 
 private:
-	bool dry;
-	bool needed;
-	std::byte *pActual;
-	const std::byte *pSource;
-	const std::byte *pTarget;
-	::Anim::Group *group;
-	const ::Anim::Options *options;
+	std::unique_ptr<StyleMorph> morph;
 };
 
 }
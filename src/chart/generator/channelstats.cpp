@@ -9,9 +9,9 @@ ChannelStats::ChannelStats(const Channel &channel,
 	sum = 0.0;
 	isDimension = channel.isDimension();
 	if (isDimension)
-		usedIndices = std::vector<Data::MultiDim::SubSliceIndex>(
-		    cube.combinedSizeOf(channel.dimensionIds),
-		    Data::MultiDim::SubSliceIndex());
+		usedIndices = std::vector<uint64_t>(
+		    (cube.combinedSizeOf(channel.dimensionIds) + 63) / 64,
+		    0);
 }
 
 void ChannelStats::track(double value)
@@ -35,7 +35,7 @@ void ChannelStats::trackSingle(double value)
 void ChannelStats::track(const Marker::Id &id)
 {
 	if (isDimension)
-		usedIndices[id.itemId] = id.itemSliceIndex;
+		usedIndices[id.itemId / 64] |= uint64_t{1} << (id.itemId % 64);
 	else
 		throw std::logic_error(
 		    "internal error: invalid measure channel tracking");
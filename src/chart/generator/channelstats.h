@@ -1,6 +1,8 @@
 #ifndef CHANNELSTATS_H
 #define CHANNELSTATS_H
 
+#include <bit>
+#include <cstdint>
 #include <vector>
 
 #include "base/math/range.h"
@@ -20,7 +22,9 @@ public:
 	bool isDimension;
 	Math::Range<double> range;
 	double sum;
-	std::vector<Data::MultiDim::SubSliceIndex> usedIndices;
+	/** Bitset of the tracked combined indices of the channel's
+	 *  dimensions, see DataCube::subSliceIndexOf. */
+	std::vector<uint64_t> usedIndices;
 
 	ChannelStats() : isDimension(true) {}
 	ChannelStats(const Channel &channel, const Data::DataCube &cube);
@@ -28,6 +32,15 @@ public:
 	void track(double value);
 	void trackSingle(double value);
 	void track(const Marker::Id &id);
+
+	template <typename Visitor>
+	void visitUsedIndices(Visitor &&visitor) const
+	{
+		for (auto word = 0u; word < usedIndices.size(); word++)
+			for (auto bits = usedIndices[word]; bits != 0;
+			     bits &= bits - 1)
+				visitor(word * 64u + std::countr_zero(bits));
+	}
 };
 
 class ChannelsStats
@@ -153,14 +153,17 @@ void Marker::resetSize(bool horizontal)
 	position.*coord = 0;
 }
 
-void Marker::setIdOffset(size_t offset)
+void Marker::remapIds(const std::vector<size_t> &positions)
 {
 	if (prevMainMarkerIdx.hasOneValue())
-		(*prevMainMarkerIdx).value += offset;
+		(*prevMainMarkerIdx).value =
+		    positions[(*prevMainMarkerIdx).value];
 	if (nextMainMarkerIdx.hasOneValue())
-		(*nextMainMarkerIdx).value += offset;
+		(*nextMainMarkerIdx).value =
+		    positions[(*nextMainMarkerIdx).value];
 	if (nextSubMarkerIdx.hasOneValue())
-		(*nextSubMarkerIdx).value += offset;
+		(*nextSubMarkerIdx).value =
+		    positions[(*nextSubMarkerIdx).value];
 }
 
 std::string Marker::toJson(const Data::DataTable &table) const
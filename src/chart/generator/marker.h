@@ -101,7 +101,7 @@ public:
 	Math::Range<double> getSizeBy(bool horizontal) const;
 	void setSizeBy(bool horizontal, const Math::Range<double> range);
 
-	void setIdOffset(size_t offset);
+	void remapIds(const std::vector<size_t> &positions);
 	std::string toJson(const Data::DataTable &table) const;
 
 private:
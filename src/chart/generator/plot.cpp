@@ -1,5 +1,6 @@
 #include "plot.h"
 
+#include <atomic>
 #include <limits>
 #include <numeric>
 
@@ -35,7 +36,7 @@ Plot::MarkerInfoContent::MarkerInfoContent()
 }
 
 Plot::MarkerInfoContent::MarkerInfoContent(const Marker &marker,
-    Data::DataCube *dataCube)
+    const Data::DataCube *dataCube)
 {
 	const auto &index = marker.index;
 	if (dataCube && dataCube->getTable() && index.size() != 0) {
@@ -75,7 +76,14 @@ bool Plot::MarkerInfoContent::operator==(
 	return markerId == op.markerId;
 }
 
+static uint64_t nextPlotId()
+{
+	static std::atomic<uint64_t> id{0};
+	return ++id;
+}
+
 Plot::Plot(PlotOptionsPtr options, const Plot &other) :
+    id(nextPlotId()),
     dataTable(other.getTable()),
     options(std::move(options))
 {
@@ -85,6 +93,7 @@ Plot::Plot(PlotOptionsPtr options, const Plot &other) :
 	dimensionAxises = other.dimensionAxises;
 	anyAxisSet = other.anyAxisSet;
 	style = other.style;
+	styleRevision = other.styleRevision;
 	keepAspectRatio = other.keepAspectRatio;
 	markersInfo = other.markersInfo;
 }
@@ -93,20 +102,21 @@ Plot::Plot(const Data::DataTable &dataTable,
     PlotOptionsPtr opts,
     Styles::Chart style,
     bool setAutoParams) :
+    id(nextPlotId()),
     dataTable(dataTable),
     options(std::move(opts)),
     style(std::move(style)),
-    dataCube(dataTable,
+    dataCube(Data::DataCube(dataTable,
         options->getChannels().getDataCubeOptions(),
-        options->dataFilter),
-    stats(options->getChannels(), dataCube)
+        options->dataFilter)),
+    stats(ChannelsStats(options->getChannels(), *dataCube))
 {
 	if (setAutoParams) options->setAutoParameters();
 
 	anySelected = false;
 	anyAxisSet = options->getChannels().anyAxisSet();
 
-	generateMarkers(dataCube, dataTable);
+	generateMarkers(*dataCube, dataTable);
 	generateMarkersInfo();
 
 	SpecLayout specLayout(*this);
@@ -130,6 +140,9 @@ Plot::Plot(const Data::DataTable &dataTable,
 	}
 
 	guides.init(axises, *options);
+
+	mainBuckets.clear();
+	subBuckets.clear();
 }
 
 void Plot::detachOptions()
@@ -148,17 +161,17 @@ void Plot::generateMarkers(const Data::DataCube &dataCube,
 	for (auto it = dataCube.getData().begin();
 	     it != dataCube.getData().end();
 	     ++it) {
-		auto itemIndex = markers.size();
+		auto itemIndex = getMarkers().size();
 
-		markers.emplace_back(*options,
+		getMarkers().emplace_back(*options,
 		    style,
 		    dataCube,
 		    table,
-		    stats,
+		    stats.write(),
 		    it.getIndex(),
 		    itemIndex);
 
-		auto &marker = markers[itemIndex];
+		auto &marker = getMarkers()[itemIndex];
 
 		mainBuckets[marker.mainId.get().seriesId][marker.mainId.get().itemId] =
 		    itemIndex;
@@ -174,9 +187,9 @@ void Plot::generateMarkers(const Data::DataCube &dataCube,
 void Plot::generateMarkersInfo()
 {
 	for (auto &mi : options->markersInfo) {
-		auto &marker = markers[mi.second];
-		markersInfo.insert(
-		    std::make_pair(mi.first, MarkerInfo{marker, &dataCube}));
+		const auto &marker = getMarkers()[mi.second];
+		getMarkersInfo().insert(std::make_pair(mi.first,
+		    MarkerInfo{marker, &*dataCube}));
 	}
 }
 
@@ -196,7 +209,7 @@ Plot::sortedBuckets(const Buckets &buckets, bool main)
 		const auto &bucket = pair.second;
 
 		for (const auto &id : bucket) {
-			auto &marker = markers[id.second];
+			auto &marker = getMarkers()[id.second];
 			auto horizontal = static_cast<bool>(options->horizontal);
 			auto size = marker.size.getCoord(!horizontal);
 			sorted[id.first].first = id.first;
@@ -228,13 +241,13 @@ void Plot::clearEmptyBuckets(const Buckets &buckets, bool main)
 		bool enabled = false;
 
 		for (const auto &id : bucket) {
-			auto &marker = markers[id.second];
+			auto &marker = getMarkers()[id.second];
 			enabled |= static_cast<bool>(marker.enabled);
 		}
 
 		if (!enabled)
 			for (const auto &id : bucket) {
-				auto &marker = markers[id.second];
+				auto &marker = getMarkers()[id.second];
 				marker.resetSize(
 				    static_cast<bool>(options->horizontal) == !main);
 			}
@@ -251,12 +264,12 @@ void Plot::linkMarkers(const Buckets &buckets, bool main)
 		for (auto i = 0u; i < sorted.size(); i++) {
 			auto idAct = sorted[i].first;
 			auto indexAct = bucket.at(idAct);
-			auto &act = markers[indexAct];
+			auto &act = getMarkers()[indexAct];
 			auto iNext = (i + 1) % sorted.size();
 			auto idNext = sorted[iNext].first;
 			auto indexNext = bucket.at(idNext);
 			act.setNextMarker(iNext,
-			    &markers[indexNext],
+			    &getMarkers()[indexNext],
 			    static_cast<bool>(options->horizontal) == main,
 			    main);
 		}
@@ -265,17 +278,17 @@ void Plot::linkMarkers(const Buckets &buckets, bool main)
 
 void Plot::normalizeXY()
 {
-	if (markers.empty()) {
-		stats.channels[ChannelId::x].range =
+	if (getMarkers().empty()) {
+		stats.write().channels[ChannelId::x].range =
 		    Math::Range<double>(0.0, 0.0);
-		stats.channels[ChannelId::y].range =
+		stats.write().channels[ChannelId::y].range =
 		    Math::Range<double>(0.0, 0.0);
 		return;
 	}
 
-	auto boundRect = markers.front().toRectangle();
+	auto boundRect = getMarkers().front().toRectangle();
 
-	for (auto &marker : markers)
+	for (auto &marker : getMarkers())
 		boundRect = boundRect.boundary(marker.toRectangle());
 
 	options->setAutoRange(boundRect.positive().hSize().getMin() >= 0,
@@ -287,7 +300,7 @@ void Plot::normalizeXY()
 	boundRect.setHSize(xrange.getRange(boundRect.hSize()));
 	boundRect.setVSize(yrange.getRange(boundRect.vSize()));
 
-	for (auto &marker : markers) {
+	for (auto &marker : getMarkers()) {
 		if (!boundRect.intersects(marker.toRectangle().positive()))
 			marker.enabled = false;
 
@@ -296,8 +309,8 @@ void Plot::normalizeXY()
 		marker.fromRectangle(newRect);
 	}
 
-	stats.channels[ChannelId::x].range = boundRect.hSize();
-	stats.channels[ChannelId::y].range = boundRect.vSize();
+	stats.write().channels[ChannelId::x].range = boundRect.hSize();
+	stats.write().channels[ChannelId::y].range = boundRect.vSize();
 }
 
 void Plot::calcAxises(const Data::DataTable &dataTable)
@@ -328,7 +341,7 @@ Axis Plot::calcAxis(ChannelId type, const Data::DataTable &dataTable)
 			auto unit =
 			    dataTable.getInfo(scale.measureId->getColIndex())
 			        .getUnit();
-			return Axis(stats.channels[type].range,
+			return Axis(stats->channels[type].range,
 			    title,
 			    unit,
 			    scale.step.getValue());
@@ -360,7 +373,7 @@ void Plot::calcDimensionAxis(ChannelId type,
 	        : scale.title;
 
 	if (type == ChannelId::x || type == ChannelId::y) {
-		for (auto marker : markers) {
+		for (const auto &marker : getMarkers()) {
 			auto &id =
 			    (type == ChannelId::x) == options->horizontal
 			        ? marker.mainId.get()
@@ -380,22 +393,22 @@ void Plot::calcDimensionAxis(ChannelId type,
 		}
 	}
 	else {
-		const auto &indices = stats.channels[type].usedIndices;
-
-		auto count = 0;
-		for (auto i = 0u; i < indices.size(); i++) {
-			const auto &sliceIndex = indices[i];
-
-			if (!sliceIndex.empty() && dim >= 0
-			    && dim < sliceIndex.size() && dim == floor(dim)) {
-				auto index = sliceIndex[dim];
-				auto range = Math::Range<double>(count, count);
-				auto inserted = axis.add(index, i, range, true);
-				if (inserted) count++;
-			}
+		if (dim >= 0 && dim < scale.dimensionIds.size()
+		    && dim == floor(dim)) {
+			auto count = 0;
+			stats->channels[type].visitUsedIndices(
+			    [&](size_t i)
+			    {
+				    auto sliceIndex =
+				        dataCube->subSliceIndexOf(scale.dimensionIds, i);
+				    auto index = sliceIndex[dim];
+				    auto range = Math::Range<double>(count, count);
+				    auto inserted = axis.add(index, i, range, true);
+				    if (inserted) count++;
+			    });
 		}
 	}
-	axis.setLabels(dataCube, table);
+	axis.setLabels(*dataCube, table);
 }
 
 void Plot::addAlignment()
@@ -411,7 +424,7 @@ void Plot::addAlignment()
 		Math::Range<double> range;
 
 		for (auto &itemIt : bucketIt.second) {
-			auto &marker = markers[itemIt.second];
+			auto &marker = getMarkers()[itemIt.second];
 			auto size =
 			    marker.getSizeBy(!static_cast<bool>(options->horizontal));
 			range.include(size);
@@ -422,7 +435,7 @@ void Plot::addAlignment()
 		auto transform = aligner.getAligned(range) / range;
 
 		for (auto &itemIt : bucketIt.second) {
-			auto &marker = markers[itemIt.second];
+			auto &marker = getMarkers()[itemIt.second];
 			auto newRange =
 			    marker.getSizeBy(!static_cast<bool>(options->horizontal))
 			    * transform;
@@ -446,7 +459,7 @@ void Plot::addSeparation()
 		for (auto &bucketIt : subBuckets) {
 			auto i = 0u;
 			for (auto &itemIt : bucketIt.second) {
-				auto &marker = markers[itemIt.second];
+				auto &marker = getMarkers()[itemIt.second];
 				auto size =
 				    marker.getSizeBy(!static_cast<bool>(options->horizontal))
 				        .size();
@@ -467,7 +480,7 @@ void Plot::addSeparation()
 		for (auto &bucketIt : subBuckets) {
 			int i = 0;
 			for (auto &itemIt : bucketIt.second) {
-				auto &marker = markers[itemIt.second];
+				auto &marker = getMarkers()[itemIt.second];
 				auto size = marker.getSizeBy(
 				    !static_cast<bool>(options->horizontal));
 
@@ -488,20 +501,20 @@ void Plot::normalizeSizes()
 	    || options->shapeType == ShapeType::line) {
 		Math::Range<double> size;
 
-		for (auto &marker : markers)
+		for (auto &marker : getMarkers())
 			if (marker.enabled) size.include(marker.sizeFactor);
 
 		auto sizeRange =
 		    options->getChannels().at(ChannelId::size).range;
 		size = sizeRange.getRange(size);
 
-		for (auto &marker : markers)
+		for (auto &marker : getMarkers())
 			marker.sizeFactor = size.getMax() == size.getMin()
 			                      ? 0
 			                      : size.normalize(marker.sizeFactor);
 	}
 	else {
-		for (auto &marker : markers) marker.sizeFactor = 0;
+		for (auto &marker : getMarkers()) marker.sizeFactor = 0;
 	}
 }
 
@@ -510,7 +523,7 @@ void Plot::normalizeColors()
 	Math::Range<double> lightness;
 	Math::Range<double> color;
 
-	for (auto &marker : markers) {
+	for (auto &marker : getMarkers()) {
 		color.include(marker.colorBuilder.color);
 		lightness.include(marker.colorBuilder.lightness);
 	}
@@ -523,7 +536,7 @@ void Plot::normalizeColors()
 	    options->getChannels().at(ChannelId::lightness).range;
 	lightness = lightnessRange.getRange(lightness);
 
-	for (auto &marker : markers) {
+	for (auto &marker : getMarkers()) {
 		marker.colorBuilder.lightness =
 		    lightness.rescale(marker.colorBuilder.lightness);
 
@@ -534,8 +547,8 @@ void Plot::normalizeColors()
 		marker.color = marker.colorBuilder.render();
 	}
 
-	stats.channels[ChannelId::color].range = color;
-	stats.channels[ChannelId::lightness].range = lightness;
+	stats.write().channels[ChannelId::color].range = color;
+	stats.write().channels[ChannelId::lightness].range = lightness;
 
 	for (auto &value : dimensionAxises.at(ChannelId::color)) {
 		ColorBuilder builder(style.plot.marker.lightnessRange(),
@@ -558,38 +571,6 @@ void Plot::normalizeColors()
 	}
 }
 
-void Plot::prependMarkers(const Plot &plot, bool enabled)
-{
-	auto size = plot.markers.size();
-
-	markers.insert(markers.begin(),
-	    plot.getMarkers().begin(),
-	    plot.getMarkers().end());
-
-	if (!enabled)
-		for (auto i = 0u; i < size; i++) markers[i].enabled = false;
-
-	for (auto i = size; i < markers.size(); i++)
-		markers[i].setIdOffset(size);
-}
-
-void Plot::appendMarkers(const Plot &plot, bool enabled)
-{
-	auto size = markers.size();
-
-	markers.insert(markers.end(),
-	    plot.getMarkers().begin(),
-	    plot.getMarkers().end());
-
-	for (auto i = size; i < markers.size(); i++) {
-		auto &marker = markers[i];
-
-		marker.setIdOffset(size);
-
-		if (!enabled) marker.enabled = false;
-	}
-}
-
 bool Plot::dimensionMatch(const Plot &a, const Plot &b)
 {
 	const auto &aDims = a.getOptions()->getChannels().getDimensions();
@@ -5,6 +5,7 @@
 #include <memory>
 #include <unordered_map>
 
+#include "base/type/copyonwrite.h"
 #include "chart/main/style.h"
 #include "chart/options/options.h"
 #include "data/table/datatable.h"
@@ -50,7 +51,7 @@ public:
 
 		MarkerInfoContent();
 		MarkerInfoContent(const Marker &marker,
-		    Data::DataCube *dataCube = nullptr);
+		    const Data::DataCube *dataCube = nullptr);
 		operator bool() const;
 		bool operator==(const MarkerInfoContent &op) const;
 	};
@@ -73,29 +74,52 @@ public:
 	    PlotOptionsPtr opts,
 	    Styles::Chart style,
 	    bool setAutoParams = true);
-	const Markers &getMarkers() const { return markers; }
-	Markers &getMarkers() { return markers; }
-	void prependMarkers(const Plot &plot, bool enabled);
-	void appendMarkers(const Plot &plot, bool enabled);
-	const MarkersInfo &getMarkersInfo() const { return markersInfo; }
-	MarkersInfo &getMarkersInfo() { return markersInfo; }
+	const Markers &getMarkers() const { return *markers; }
+	Markers &getMarkers() { return markers.write(); }
+	const MarkersInfo &getMarkersInfo() const { return *markersInfo; }
+	MarkersInfo &getMarkersInfo() { return markersInfo.write(); }
 	PlotOptionsPtr getOptions() const { return options; }
-	const Data::DataCube &getDataCube() const { return dataCube; }
-	const ChannelsStats &getStats() const { return stats; }
+	const Data::DataCube &getDataCube() const { return *dataCube; }
+	const ChannelsStats &getStats() const { return *stats; }
 	const Styles::Chart &getStyle() const { return style; }
 	Styles::Chart &getStyle() { return style; }
+	/** Taken anew by the writers changing the values of the style,
+	 *  i.e. the style morph of an animation. */
+	const Styles::Revision &getStyleRevision() const
+	{
+		return styleRevision;
+	}
+	Styles::Revision &getStyleRevision() { return styleRevision; }
 	const Data::DataTable &getTable() const { return dataTable; };
+
+	/**
+	 * Identifies the generation the plot comes from. Copies (e.g. the
+	 * ones handed out by the plot cache) share it.
+	 */
+	uint64_t getId() const { return id; }
+	/**
+	 * Handles sharing the storage of the markers and of the markers
+	 * info. Changing them through the plot detaches the plot from the
+	 * handles, so comparing handles tells whether they were changed.
+	 */
+	Type::CopyOnWrite<Markers> shareMarkers() const { return markers; }
+	Type::CopyOnWrite<MarkersInfo> shareMarkersInfo() const
+	{
+		return markersInfo;
+	}
 	void detachOptions();
 	bool isEmpty() const;
 
 private:
+	uint64_t id;
 	const Data::DataTable &dataTable;
 	PlotOptionsPtr options;
 	Styles::Chart style;
-	Data::DataCube dataCube;
-	ChannelsStats stats;
-	Markers markers;
-	MarkersInfo markersInfo;
+	Styles::Revision styleRevision;
+	Type::CopyOnWrite<Data::DataCube> dataCube;
+	Type::CopyOnWrite<ChannelsStats> stats;
+	Type::CopyOnWrite<Markers> markers;
+	Type::CopyOnWrite<MarkersInfo> markersInfo;
 
 	Buckets mainBuckets;
 	Buckets subBuckets;
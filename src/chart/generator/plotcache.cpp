@@ -0,0 +1,64 @@
+#include "plotcache.h"
+
+#include <functional>
+
+using namespace Vizzu;
+using namespace Vizzu::Gen;
+
+PlotCache::Key::Key(const Options &options,
+    const Styles::Revision &styles,
+    const Geom::Size &size,
+    uint64_t tableVersion) :
+    options(options),
+    styles(styles),
+    size(size),
+    tableVersion(tableVersion)
+{
+	hash = std::hash<uint64_t>{}(styles.get());
+	hash ^= std::hash<double>{}(size.x) + (hash << 6) + (hash >> 2);
+	hash ^= std::hash<double>{}(size.y) + (hash << 6) + (hash >> 2);
+	hash ^= std::hash<uint64_t>{}(tableVersion) + (hash << 6)
+	      + (hash >> 2);
+}
+
+PlotCache::PlotCache(std::size_t capacity) : capacity(capacity) {}
+
+PlotPtr PlotCache::get(const Key &key)
+{
+	for (auto it = entries.begin(); it != entries.end(); ++it) {
+		if (matches(*it, key)) {
+			entries.splice(entries.begin(), entries, it);
+			auto res = std::make_shared<Plot>(*it->plot);
+			res->detachOptions();
+			return res;
+		}
+	}
+	return {};
+}
+
+void PlotCache::add(Key key, const PlotPtr &plot)
+{
+	if (capacity == 0) return;
+
+	if (!entries.empty()
+	    && entries.front().key.tableVersion != key.tableVersion)
+		entries.clear();
+
+	auto stored = std::make_shared<Plot>(*plot);
+	stored->detachOptions();
+
+	entries.push_front(Entry{std::move(key), std::move(stored)});
+	if (entries.size() > capacity) entries.pop_back();
+}
+
+void PlotCache::clear() { entries.clear(); }
+
+bool PlotCache::matches(const Entry &entry, const Key &key)
+{
+	return entry.key.hash == key.hash
+	    && entry.key.tableVersion == key.tableVersion
+	    && entry.key.size == key.size
+	    && entry.key.styles == key.styles
+	    && (entry.key.options == key.options
+	        || *entry.plot->getOptions() == key.options);
+}
@@ -0,0 +1,63 @@
+#ifndef PLOTCACHE_H
+#define PLOTCACHE_H
+
+#include <cstdint>
+#include <list>
+#include <memory>
+
+#include "base/geom/point.h"
+#include "chart/main/style.h"
+#include "chart/options/options.h"
+
+#include "plot.h"
+
+namespace Vizzu
+{
+namespace Gen
+{
+
+/**
+ * Keeps the most recently generated plots, so that setting a keyframe
+ * structurally equal to an earlier one does not regenerate the plot.
+ * Stored plots are immutable, lookups hand out copies of them.
+ */
+class PlotCache
+{
+public:
+	struct Key
+	{
+		Key(const Options &options,
+		    const Styles::Revision &styles,
+		    const Geom::Size &size,
+		    uint64_t tableVersion);
+
+		Options options;
+		Styles::Revision styles;
+		Geom::Size size;
+		uint64_t tableVersion;
+		std::size_t hash;
+	};
+
+	explicit PlotCache(std::size_t capacity = 8);
+
+	PlotPtr get(const Key &key);
+	void add(Key key, const PlotPtr &plot);
+	void clear();
+
+private:
+	struct Entry
+	{
+		Key key;
+		std::shared_ptr<const Plot> plot;
+	};
+
+	std::size_t capacity;
+	std::list<Entry> entries;
+
+	static bool matches(const Entry &entry, const Key &key);
+};
+
+}
+}
+
+#endif
@@ -1,5 +1,7 @@
 #include "selector.h"
 
+#include <utility>
+
 using namespace Vizzu;
 using namespace Vizzu::Gen;
 
@@ -8,16 +10,18 @@ Selector::Selector(Plot &plot) : plot(plot) {}
 void Selector::clearSelection()
 {
 	plot.anySelected = false;
-	for (auto &marker : plot.markers) marker.selected = false;
+	for (auto &marker : plot.getMarkers()) marker.selected = false;
 }
 
-void Selector::toggleMarker(Marker &marker, bool add)
+void Selector::toggleMarker(const Marker &marker, bool add)
 {
+	const auto &markers = std::as_const(plot).getMarkers();
+	auto index = static_cast<size_t>(&marker - markers.data());
 	auto alreadySelected = marker.selected;
 
 	if (!add) clearSelection();
 
-	marker.selected = !alreadySelected;
+	plot.getMarkers().at(index).selected = !alreadySelected;
 
 	plot.anySelected = anySelected();
 }
@@ -85,7 +89,7 @@ void Selector::setSelection(
     const Data::MultiDim::SubSliceIndex &index,
     bool selected)
 {
-	for (auto &marker : plot.markers)
+	for (auto &marker : plot.getMarkers())
 		if (marker.enabled && index.contains(marker.index)) {
 			marker.selected = selected;
 		}
@@ -95,7 +99,7 @@ void Selector::setSelection(
 void Selector::andSelection(
     const Data::MultiDim::SubSliceIndex &index)
 {
-	for (auto &marker : plot.markers)
+	for (auto &marker : plot.getMarkers())
 		if (marker.enabled && marker.selected) {
 			marker.selected = index.contains(marker.index);
 		}
@@ -1,5 +1,7 @@
 #include "chart.h"
 
+#include <utility>
+
 #include "chart/options/advancedoptions.h"
 #include "chart/rendering/drawbackground.h"
 #include "chart/rendering/drawitem.h"
@@ -25,6 +27,8 @@ Chart::Chart() :
 	    [&](Gen::PlotPtr actPlot)
 	    {
 		    this->actPlot = std::move(actPlot);
+		    drawItems.invalidate();
+		    markerIndex.reset();
 		    if (onChanged) onChanged();
 	    });
 	animator->onProgress.attach(
@@ -45,8 +49,10 @@ Chart::Chart() :
 	};
 }
 
-void Chart::setBoundRect(const Geom::Rect &rect, Gfx::ICanvas &info)
+void Chart::setBoundRect(const Geom::Rect &rect, Gfx::ICanvas &canvas)
 {
+	Gfx::TextMetricsCanvas info(canvas, textMetrics);
+
 	if (actPlot) {
 		actPlot->getStyle().setup();
 		layout.setBoundary(rect, *actPlot, info);
@@ -61,6 +67,8 @@ void Chart::animate(OnComplete onComplete)
 	auto f = [=, this](Gen::PlotPtr plot, bool ok)
 	{
 		actPlot = plot;
+		drawItems.invalidate();
+		markerIndex.reset();
 		if (ok) {
 			prevOptions = *nextOptions;
 			prevStyles = actStyles;
@@ -68,6 +76,7 @@ void Chart::animate(OnComplete onComplete)
 		else {
 			*nextOptions = prevOptions;
 			actStyles = prevStyles;
+			stylesRevision.bump();
 			computedStyles = plot->getStyle();
 		}
 		if (onComplete) onComplete(ok);
@@ -100,50 +109,102 @@ Gen::OptionsSetterPtr Chart::getSetter()
 	return setter;
 }
 
-void Chart::draw(Gfx::ICanvas &canvas)
+void Chart::draw(Gfx::ICanvas &target)
 {
+	Gfx::TextMetricsCanvas canvas(target, textMetrics);
+	std::optional<Geom::Rect> damage;
+
 	if (actPlot
 	    && (!events.draw.begin
 	        || events.draw.begin->invoke(
 	            Util::EventDispatcher::Params{}))) 
 	{
-		Draw::DrawingContext context(canvas, layout, events.draw, *actPlot);
-
-		Draw::drawBackground(
-		    layout.boundary.outline(Geom::Size::Square(1)),
-		    canvas,
-		    actPlot->getStyle(),
-		    events.draw.background,
-		    Events::OnRectDrawParam(""));
-
-		Draw::drawPlot drawPlot(context);
-
-		actPlot->getOptions()->legend.visit(
-		    [&](int, const auto &legend)
-		    {
-			    if (legend.value)
-				    Draw::drawLegend(context,
-				        *legend.value,
-				        legend.weight);
-		    });
-
-		actPlot->getOptions()->title.visit(
-		    [&](int, const auto &title)
-		    {
-			    Events::Events::OnTextDrawParam param("title");
-			    if (title.value.has_value())
-				    Draw::drawLabel(layout.title,
-				        *title.value,
-				        actPlot->getStyle().title,
-				        events.draw.title,
-				        std::move(param),
-				        canvas,
-				        Draw::drawLabel::Options(true,
-				            std::max(title.weight * 2 - 1, 0.0)));
-		    });
-
-		Draw::drawMarkerInfo(layout, canvas, *actPlot);
-
+		Draw::DrawingContext context(canvas,
+		    layout,
+		    events.draw,
+		    *actPlot,
+		    quality.get(),
+		    drawItems,
+		    pathCache);
+
+		auto layerContext = [&](Gfx::ICanvas &layerCanvas)
+		{
+			return Draw::DrawingContext(layerCanvas,
+			    layout,
+			    events.draw,
+			    *actPlot,
+			    quality.get(),
+			    drawItems,
+			    pathCache);
+		};
+
+		layers.update(Draw::LayerState(*actPlot,
+		    layout,
+		    quality.get(),
+		    events.draw,
+		    animator->getControl().isRunning(),
+		    layers.getState()));
+
+		auto drawBase = [&](Gfx::ICanvas &layerCanvas)
+		{
+			Draw::drawBackground(
+			    layout.boundary.outline(Geom::Size::Square(1)),
+			    layerCanvas,
+			    actPlot->getStyle(),
+			    events.draw.background,
+			    Events::OnRectDrawParam(""));
+
+			Draw::drawPlot(layerContext(layerCanvas)).drawBase();
+		};
+
+		auto drawContent = [&](Gfx::ICanvas &layerCanvas)
+		{
+			Draw::drawPlot(layerContext(layerCanvas)).drawContent();
+		};
+
+		auto drawLabels = [&](Gfx::ICanvas &layerCanvas)
+		{
+			auto labelContext = layerContext(layerCanvas);
+
+			Draw::drawPlot(labelContext).drawLabels();
+
+			actPlot->getOptions()->legend.visit(
+			    [&](int, const auto &legend)
+			    {
+				    if (legend.value)
+					    Draw::drawLegend(labelContext,
+					        *legend.value,
+					        legend.weight);
+			    });
+
+			actPlot->getOptions()->title.visit(
+			    [&](int, const auto &title)
+			    {
+				    Events::Events::OnTextDrawParam param("title");
+				    if (title.value.has_value())
+					    Draw::drawLabel(layout.title,
+					        *title.value,
+					        actPlot->getStyle().title,
+					        events.draw.title,
+					        std::move(param),
+					        layerCanvas,
+					        Draw::drawLabel::Options(true,
+					            std::max(title.weight * 2 - 1, 0.0)));
+			    });
+		};
+
+		auto drawOverlays = [&](Gfx::ICanvas &layerCanvas)
+		{
+			Draw::drawMarkerInfo(layout,
+			    layerCanvas,
+			    *actPlot,
+			    quality.get().dropShadows);
+		};
+
+		layers.draw(canvas,
+		    {drawBase, drawContent, drawLabels, drawOverlays});
+
+		damage = layers.getDamage();
 		renderedChart = context.renderedChart;
 	}
 
@@ -154,9 +215,21 @@ void Chart::draw(Gfx::ICanvas &canvas)
 
 		auto logoRect = getLogoBoundary();
 
-		Draw::Logo(canvas).draw(logoRect.pos,
-		    logoRect.width(),
-		    filter);
+		// outside of a partially repainted area the logo is kept
+		auto repainted =
+		    damage ? damage->intersection(logoRect).size.area() > 0
+		           : true;
+
+		if (repainted) {
+			if (damage) {
+				canvas.save();
+				canvas.setClipRect(*damage);
+			}
+			Draw::Logo(canvas).draw(logoRect.pos,
+			    logoRect.width(),
+			    filter);
+			if (damage) canvas.restore();
+		}
 	}
 
 	if (events.draw.complete)
@@ -187,12 +260,30 @@ Geom::Rect Chart::getLogoBoundary() const
 
 Gen::PlotPtr Chart::plot(Gen::PlotOptionsPtr options)
 {
+	Gen::PlotCache::Key key(*options,
+	    stylesRevision,
+	    layout.boundary.size,
+	    table.getVersion());
+
+	if (auto cached = plotCache.get(key)) {
+		auto tooltipId = options->tooltipId;
+		*options = *cached->getOptions();
+		options->tooltipId = tooltipId;
+		cached->getOptions()->tooltipId = tooltipId;
+		computedStyles = cached->getStyle();
+		return cached;
+	}
+
 	computedStyles =
 	    stylesheet.getFullParams(options, layout.boundary.size);
 
-	return std::make_shared<Gen::Plot>(table,
+	auto res = std::make_shared<Gen::Plot>(table,
 	    options,
 	    computedStyles);
+
+	plotCache.add(std::move(key), res);
+
+	return res;
 }
 
 Draw::CoordinateSystem Chart::getCoordSystem() const
@@ -213,30 +304,43 @@ Draw::CoordinateSystem Chart::getCoordSystem() const
 	    Math::FuzzyBool());
 }
 
-Gen::Marker *Chart::markerAt(const Geom::Point &point) const
+const Gen::Marker *Chart::markerAt(const Geom::Point &point) const
 {
 	if (actPlot) {
-		const auto &plotArea = layout.plotArea;
-		const auto &options = *actPlot->getOptions();
+		const auto &plot = std::as_const(*actPlot);
+		const auto &style = plot.getStyle();
+		// the same area the markers were drawn into
+		auto plotArea = style.plot.contentRect(layout.plot,
+		    style.calculatedSize());
 
-		Draw::CoordinateSystem coordSys(plotArea,
-		    options.angle,
-		    options.polar,
-		    actPlot->keepAspectRatio);
+		drawItems.update(plot, plotArea);
 
-		auto originalPos = coordSys.getOriginal(point);
+		auto originalPos =
+		    drawItems.getCoordSys().getOriginal(point);
 
-		for (auto &marker : actPlot->getMarkers()) {
-			auto drawItem = Draw::DrawItem::createInterpolated(
-			    marker,
-			    options,
-			    actPlot->getStyle(),
-			    coordSys,
-			    actPlot->getMarkers(),
-			    0);
+		const auto &markers = plot.getMarkers();
+
+		// the plot changes on every frame while animating
+		if (animator->getControl().isRunning()) {
+			for (const auto &marker : markers)
+				if (drawItems.get(marker, 0).bounds(originalPos))
+					return &marker;
+			return nullptr;
+		}
 
-			if (drawItem.bounds(originalPos)) return &marker;
+		if (!markerIndex || markerIndexArea != plotArea) {
+			std::vector<std::optional<Geom::Rect>> boundaries;
+			boundaries.reserve(markers.size());
+			for (const auto &marker : markers)
+				boundaries.push_back(
+				    drawItems.get(marker, 0).hitBoundary());
+			markerIndex.emplace(boundaries);
+			markerIndexArea = plotArea;
 		}
+
+		for (auto index : markerIndex->find(originalPos))
+			if (drawItems.get(markers[index], 0).bounds(originalPos))
+				return &markers[index];
 	}
 	return nullptr;
 }
@@ -244,7 +348,7 @@ Gen::Marker *Chart::markerAt(const Geom::Point &point) const
 const Gen::Marker *Chart::markerByIndex(size_t index) const
 {
 	if (actPlot) {
-		auto &markers = actPlot->getMarkers();
+		const auto &markers = std::as_const(*actPlot).getMarkers();
 		if (index < markers.size()) return &markers[index];
 	}
 	return nullptr;
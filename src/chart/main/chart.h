@@ -6,15 +6,22 @@
 #include <string>
 
 #include "base/anim/control.h"
+#include "base/geom/spatialindex.h"
 #include "base/gfx/canvas.h"
+#include "base/gfx/textmetrics.h"
 #include "base/gui/scheduler.h"
 #include "base/util/eventdispatcher.h"
 #include "chart/animator/animator.h"
 #include "chart/generator/plot.h"
+#include "chart/generator/plotcache.h"
 #include "chart/main/layout.h"
 #include "chart/main/stylesheet.h"
 #include "chart/options/config.h"
+#include "chart/rendering/items/drawitemcache.h"
+#include "chart/rendering/layercache.h"
 #include "chart/rendering/painter/coordinatesystem.h"
+#include "chart/rendering/painter/pathcache.h"
+#include "chart/rendering/quality.h"
 #include "chart/rendering/renderedchart.h"
 #include "data/table/datatable.h"
 
@@ -37,13 +44,21 @@ public:
 
 	Data::DataTable &getTable() { return table; }
 	Gen::OptionsSetterPtr getSetter();
-	Styles::Sheet &getStylesheet() { return stylesheet; }
-	Styles::Chart &getStyles() { return actStyles; }
+	const Styles::Sheet &getStylesheet() const { return stylesheet; }
+	void setStyleParams(const std::string &path,
+	    const std::string &value)
+	{
+		stylesheet.setParams(path, value);
+		stylesRevision.bump();
+	}
+	const Styles::Chart &getStyles() const { return actStyles; }
 	Styles::Chart &getComputedStyles() { return computedStyles; }
 	void setStyles(const Styles::Chart &styles)
 	{
 		actStyles = styles;
 		actStyles.setup();
+		stylesRevision.bump();
+		textMetrics.clear();
 	}
 	Gen::Options getOptions() { return *nextOptions; }
 	void setOptions(const Gen::Options &options)
@@ -60,6 +75,19 @@ public:
 		return animator->getActAnimation();
 	}
 	Anim::Options &getAnimOptions() { return nextAnimOptions; }
+	void setWorkerPool(std::shared_ptr<Util::WorkerPool> pool)
+	{
+		animator->setWorkerPool(std::move(pool));
+	}
+	void setBakeCache(std::shared_ptr<Anim::BakeCache> cache)
+	{
+		animator->setBakeCache(std::move(cache));
+	}
+	void setPlanCache(std::shared_ptr<Anim::PlanCache> cache)
+	{
+		animator->setPlanCache(std::move(cache));
+	}
+	Draw::QualityController &getQuality() { return quality; }
 	Events &getEvents() { return events; }
 	const Layout &getLayout() const { return layout; }
 	Util::EventDispatcher &getEventDispatcher()
@@ -73,7 +101,7 @@ public:
 	void animate(OnComplete onComplete = OnComplete());
 	void setKeyframe();
 	void setAnimation(const Anim::AnimationPtr &animation);
-	Gen::Marker *markerAt(const Geom::Point &point) const;
+	const Gen::Marker *markerAt(const Geom::Point &point) const;
 	const Gen::Marker *markerByIndex(size_t index) const;
 	Geom::Rect getLogoBoundary() const;
 
@@ -87,11 +115,21 @@ private:
 	Anim::Options nextAnimOptions;
 	Styles::Sheet stylesheet;
 	Styles::Chart actStyles;
+	/** Taken anew by every change of actStyles. */
+	Styles::Revision stylesRevision;
 	Styles::Chart prevStyles;
 	Styles::Chart computedStyles;
 	Util::EventDispatcher eventDispatcher;
 	Draw::RenderedChart renderedChart;
+	Gen::PlotCache plotCache;
 	Events events;
+	Draw::QualityController quality;
+	Gfx::TextMetricsCache textMetrics;
+	mutable Draw::DrawItemCache drawItems;
+	Draw::PathCache pathCache;
+	Draw::LayerCache layers;
+	mutable std::optional<Geom::SpatialIndex> markerIndex;
+	mutable Geom::Rect markerIndexArea;
 
 	Gen::PlotPtr plot(Gen::PlotOptionsPtr options);
 };
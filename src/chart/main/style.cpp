@@ -1,5 +1,7 @@
 #include "style.h"
 
+#include <atomic>
+
 #include "chart/rendering/palettes.h"
 
 using namespace Vizzu;
@@ -378,3 +380,9 @@ Chart Chart::def()
 	        Gfx::ColorTransform::OverrideColor(
 	            Gfx::Color::Gray(0.85))}};
 }
+
+uint64_t Revision::next()
+{
+	static std::atomic<uint64_t> revision{0};
+	return ++revision;
+}
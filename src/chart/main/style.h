@@ -1,6 +1,8 @@
 #ifndef STYLE_H
 #define STYLE_H
 
+#include <cstdint>
+
 #include "base/anim/interpolated.h"
 #include "base/geom/angle.h"
 #include "base/geom/rect.h"
@@ -470,6 +472,26 @@ struct Chart : Padding, Box, Font
 	}
 };
 
+/**
+ * Identifies the values of a chart style without comparing its
+ * parameters: the owner of a style takes a new revision whenever the
+ * style may change, copies of an unchanged style keep theirs.
+ */
+class Revision
+{
+public:
+	Revision() : value(next()) {}
+
+	void bump() { value = next(); }
+	uint64_t get() const { return value; }
+	bool operator==(const Revision &) const = default;
+
+private:
+	uint64_t value;
+
+	static uint64_t next();
+};
+
 }
 }
 
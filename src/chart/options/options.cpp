@@ -16,6 +16,7 @@ uint64_t Options::nextMarkerInfoId = 1;
 Options::Options()
 	: title(std::nullopt)
 	, polar(false)
+	, angle(0.0)
 	, shapeType(ShapeType::rectangle)
 	, horizontal(true)
 	, alignType(Base::Align::Type::none)
@@ -28,7 +28,7 @@ void drawAxes::drawBase()
 
 void drawAxes::drawLabels()
 {
-	drawInterlacing(*this, true);
+	if (quality.interlacingLabels) drawInterlacing(*this, true);
 
 	drawDimensionLabels(true);
 	drawDimensionLabels(false);
@@ -266,6 +266,12 @@ void drawAxes::drawDimensionLabels(bool horizontal)
 	if (axis.enabled) {
 		canvas.setFont(Gfx::Font(labelStyle));
 
+		std::vector<std::string> labels;
+		for (const auto &value : axis)
+			if (value.second.weight != 0)
+				labels.push_back(value.second.label);
+		canvas.textBoundaries(labels);
+
 		Gen::DimensionAxis::Values::const_iterator it;
 		for (it = axis.begin(); it != axis.end(); ++it) {
 			drawDimensionLabel(horizontal, origo, it);
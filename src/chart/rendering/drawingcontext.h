@@ -6,8 +6,10 @@
 #include "chart/main/events.h"
 #include "chart/main/style.h"
 #include "chart/main/layout.h"
+#include "items/drawitemcache.h"
 #include "painter/coordinatesystem.h"
 #include "painter/painter.h"
+#include "quality.h"
 #include "renderedchart.h"
 
 namespace Vizzu
@@ -22,14 +24,19 @@ public:
 	    Gfx::ICanvas &canvas,
 	    const Layout &layout,
 	    const Events::Draw &events,
-	    const Gen::Plot &plot) :
+	    const Gen::Plot &plot,
+	    const Quality &quality,
+	    DrawItemCache &drawItems,
+	    PathCache &pathCache) :
 	    plot(plot),
 	    canvas(canvas),
 	    painter(*static_cast<Painter *>(canvas.getPainter())),
 	    options(*plot.getOptions()),
 	    style(plot.getStyle()),
 	    events(events),
-		layout(layout)
+		layout(layout),
+	    quality(quality),
+	    drawItems(drawItems)
 	{
 		auto plotArea = style.plot.contentRect
 			(layout.plot, style.calculatedSize());
@@ -41,6 +48,9 @@ public:
 		    plot.keepAspectRatio);
 
 		painter.setCoordSys(coordSys);
+		painter.setPathCache(&pathCache);
+
+		drawItems.update(plot, plotArea);
 
 		renderedChart = RenderedChart(coordSys);
 	}
@@ -53,6 +63,8 @@ public:
 	const Styles::Chart &style;
 	const Events::Draw &events;
 	const Layout &layout;
+	Quality quality;
+	DrawItemCache &drawItems;
 	RenderedChart renderedChart;
 };
 
@@ -26,12 +26,8 @@ void drawItem::drawLines(const Styles::Guide &style,
 {
 	if (static_cast<double>(marker.enabled) == 0) return;
 
-	auto blended = DrawItem::createInterpolated(marker,
-	    options,
-	    plot.getStyle(),
-	    coordSys,
-	    plot.getMarkers(),
-	    0);
+	const auto &blended = drawItems.get(marker, 0);
+	auto center = blended.center;
 
 	auto baseColor = *style.color * static_cast<double>(plot.anyAxisSet);
 
@@ -40,8 +36,8 @@ void drawItem::drawLines(const Styles::Guide &style,
 			auto lineColor =
 			    baseColor * static_cast<double>(plot.guides.x.guidelines);
 			canvas.setLineColor(lineColor);
-			auto axisPoint = blended.center.xComp() + origo.yComp();
-			Geom::Line line(axisPoint, blended.center);
+			auto axisPoint = center.xComp() + origo.yComp();
+			Geom::Line line(axisPoint, center);
 			if (events.plot.marker.guide->invoke(
 			        Events::OnLineDrawParam("plot.marker.guide.x",
 			            line,
@@ -50,14 +46,14 @@ void drawItem::drawLines(const Styles::Guide &style,
 			}
 		}
 		if (static_cast<double>(plot.guides.y.guidelines) > 0) {
-			blended.center.x = Math::interpolate(blended.center.x,
+			center.x = Math::interpolate(center.x,
 			    1.0,
 			    static_cast<double>(options.polar));
 			auto lineColor =
 			    baseColor * static_cast<double>(plot.guides.y.guidelines);
 			canvas.setLineColor(lineColor);
-			auto axisPoint = blended.center.yComp() + origo.xComp();
-			Geom::Line line(blended.center, axisPoint);
+			auto axisPoint = center.yComp() + origo.xComp();
+			Geom::Line line(center, axisPoint);
 			if (events.plot.marker.guide->invoke(
 			        Events::OnLineDrawParam("plot.marker.guide.y",
 			            line,
@@ -97,12 +93,7 @@ void drawItem::draw()
 	else 
 	{
 		auto drawMarker = [&, this](int index, ::Anim::Weighted<uint64_t> value) {
-			auto blended0 = DrawItem::createInterpolated(marker,
-				options,
-				plot.getStyle(),
-				coordSys,
-				plot.getMarkers(),
-				index);
+			const auto &blended0 = drawItems.get(marker, index);
 	
 			auto lineFactor = 
 				options.shapeType.factor<double>(Gen::ShapeType::line);
@@ -135,16 +126,18 @@ void drawItem::draw()
 	}
 }
 
+void drawItem::draw(MarkerBatches &batches)
+{
+	this->batches = &batches;
+	draw();
+	this->batches = nullptr;
+}
+
 void drawItem::drawLabel()
 {
 	if (static_cast<double>(marker.enabled) == 0) return;
 
-	auto blended = DrawItem::createInterpolated(marker,
-	    options,
-	    plot.getStyle(),
-	    coordSys,
-	    plot.getMarkers(),
-	    0);
+	const auto &blended = drawItems.get(marker, 0);
 
 	drawLabel(blended, 0);
 	drawLabel(blended, 1);
@@ -167,6 +160,27 @@ bool drawItem::shouldDrawMarkerBody()
 	return enabled;
 }
 
+drawItem::Culling drawItem::cull(
+    const std::pair<Gfx::Color, Gfx::Color> &colors,
+    const std::optional<Geom::Rect> &bounds,
+    double borderWidth,
+    const Geom::Rect &viewport)
+{
+	if (colors.first.alpha == 0 && colors.second.alpha == 0)
+		return Culling::skip;
+
+	if (!bounds) return Culling::shape;
+
+	if (!bounds->outline(Geom::Size::Square(borderWidth))
+	         .intersects(viewport))
+		return Culling::skip;
+
+	if (bounds->width() < 1.0 && bounds->height() < 1.0)
+		return Culling::pixel;
+
+	return Culling::shape;
+}
+
 void drawItem::draw(const DrawItem &drawItem,
     double factor,
     bool line)
@@ -176,10 +190,43 @@ void drawItem::draw(const DrawItem &drawItem,
 	painter.setPolygonToCircleFactor(
 	    line ? 0.0 : static_cast<double>(drawItem.morphToCircle));
 	painter.setPolygonStraightFactor(static_cast<double>(drawItem.linear));
-	painter.setResMode(ResolutionMode::High);
+	painter.setResMode(quality.resolution);
 
 	auto colors = getColor(drawItem, factor);
 
+	// culling would swallow the draw events of the skipped markers
+	if (!*events.plot.marker.base) {
+		auto bounds = getPixelBoundary(drawItem, line);
+		switch (cull(colors,
+		    bounds,
+		    *style.plot.marker.borderWidth,
+		    getViewport())) {
+		case Culling::skip: return;
+		case Culling::pixel:
+			if (batches) {
+				batches->add({Gfx::Color(), colors.second, 0},
+				    *bounds);
+				return;
+			}
+			canvas.setBrushColor(colors.second);
+			canvas.setLineWidth(0);
+			canvas.rectangle(*bounds);
+			return;
+		case Culling::shape: break;
+		}
+
+		if (batches && !line) {
+			auto borderWidth = *style.plot.marker.borderWidth;
+			if (bounds)
+				bounds =
+				    bounds->outline(Geom::Size::Square(borderWidth));
+			batches->add({colors.first, colors.second, borderWidth},
+			    drawItem,
+			    bounds);
+			return;
+		}
+	}
+
 	canvas.setLineColor(colors.first);
 	canvas.setLineWidth(*style.plot.marker.borderWidth);
 	canvas.setBrushColor(colors.second);
@@ -212,12 +259,61 @@ void drawItem::draw(const DrawItem &drawItem,
 		        Events::OnRectDrawParam("plot.marker",
 		            rect,
 		            drawItem.marker.idx))) {
-			painter.drawPolygon(drawItem.points);
+			painter.drawPolygon(drawItem.points,
+			    false,
+			    drawItem.marker.idx);
 		}
 	}
 	canvas.setLineWidth(0);
 }
 
+std::optional<Geom::Rect> drawItem::getPixelBoundary(
+    const DrawItem &drawItem,
+    bool line) const
+{
+	// the polar transform is not affine, converted corners would not
+	// bound the shape
+	if (options.polar != false) return std::nullopt;
+
+	Geom::Rect res;
+	if (line) {
+		auto itemLine = drawItem.getLine();
+		res = Geom::Rect(Geom::Line(coordSys.convert(itemLine.begin),
+		                     coordSys.convert(itemLine.end)))
+		          .positive();
+		auto width =
+		    std::max(drawItem.lineWidth[0], drawItem.lineWidth[1])
+		    * coordSys.getRect().size.minSize();
+		res = res.outline(Geom::Size::Square(width));
+	}
+	else {
+		std::array<Geom::Point, 4> points;
+		for (auto i = 0u; i < points.size(); i++)
+			points[i] = coordSys.convert(drawItem.points[i]);
+		res = Geom::Rect::Boundary(points);
+
+		// morphing to circle stays within the square of the larger
+		// side around the center
+		auto halfSide = std::max(res.width(), res.height()) / 2.0;
+		res = res.boundary(
+		    Geom::Rect(res.center() - Geom::Point(halfSide, halfSide),
+		        Geom::Size::Square(2 * halfSide)));
+	}
+	return res;
+}
+
+Geom::Rect drawItem::getViewport() const
+{
+	if (style.plot.overflow != Styles::Overflow::hidden)
+		return layout.boundary;
+
+	return Geom::Rect::Boundary(
+	    std::array<Geom::Point, 4>{coordSys.convert(Geom::Point(0, 0)),
+	        coordSys.convert(Geom::Point(0, 1)),
+	        coordSys.convert(Geom::Point(1, 1)),
+	        coordSys.convert(Geom::Point(1, 0))});
+}
+
 void drawItem::drawLabel(const DrawItem &drawItem, size_t index)
 {
 	if (static_cast<double>(drawItem.labelEnabled) == 0) return;
@@ -353,8 +449,7 @@ std::pair<Gfx::Color, Gfx::Color> drawItem::getColor(
 
 	double highlight = 0.0;
 	double anyHighlight = 0.0;
-	auto markerInfo = plot.getMarkersInfo();
-	for (auto &info : markerInfo) {
+	for (const auto &info : plot.getMarkersInfo()) {
 		auto allHighlight = 0.0;
 		info.second.visit(
 		    [&](int, const auto &info)
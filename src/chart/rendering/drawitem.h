@@ -1,7 +1,11 @@
 #ifndef DRAWITEM_H
 #define DRAWITEM_H
 
+#include <optional>
+#include <utility>
+
 #include "chart/rendering/items/drawitem.h"
+#include "chart/rendering/items/markerbatches.h"
 
 #include "drawingcontext.h"
 
@@ -13,15 +17,31 @@ namespace Draw
 class drawItem : private DrawingContext
 {
 public:
+	enum class Culling { skip, pixel, shape };
+
+	/** Decides how a marker body is drawn. Transparent markers and
+	 *  markers outside of the viewport even with their border are
+	 *  skipped; markers smaller than a pixel are drawn as a pixel.
+	 *  Markers without pixel bounds are drawn as shapes. */
+	static Culling cull(
+	    const std::pair<Gfx::Color, Gfx::Color> &colors,
+	    const std::optional<Geom::Rect> &bounds,
+	    double borderWidth,
+	    const Geom::Rect &viewport);
+
 	drawItem(const Gen::Marker &marker,
 	    const DrawingContext &context);
 	void drawLines(const Styles::Guide &style,
 	    const Geom::Point &origo);
 	void draw();
+	/** Collects the polygon bodies of the marker instead of drawing
+	 *  them; only for markers without line shape. */
+	void draw(MarkerBatches &batches);
 	void drawLabel();
 
 private:
 	const Gen::Marker &marker;
+	MarkerBatches *batches{};
 
 	bool shouldDrawMarkerBody();
 	std::pair<Gfx::Color, Gfx::Color> getColor(
@@ -29,6 +49,9 @@ private:
 	    double factor,
 	    bool label = false);
 	void draw(const DrawItem &drawItem, double factor, bool line);
+	std::optional<Geom::Rect> getPixelBoundary(const DrawItem &drawItem,
+	    bool line) const;
+	Geom::Rect getViewport() const;
 	void drawLabel(const DrawItem &drawItem, size_t index);
 
 	Gfx::Color getSelectedColor();
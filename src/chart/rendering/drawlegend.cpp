@@ -72,6 +72,15 @@ void drawLegend::drawDimension(const Gen::DimensionAxis &axis)
 
 	drawTitle(axis.title);
 
+	std::vector<std::string> labels;
+	for (const auto &value : axis)
+		if (value.second.weight > 0)
+			labels.push_back(value.second.label);
+	canvas.save();
+	canvas.setFont(Gfx::Font(style.label));
+	canvas.textBoundaries(labels);
+	canvas.restore();
+
 	for (auto value : axis) {
 		if (value.second.weight > 0) {
 			auto itemRect = getItemRect(value.second.range.getMin());
@@ -35,16 +35,18 @@ void drawMarkerInfo::MarkerDC::draw(double weight)
 	parent.canvas.setLineWidth(*parent.style.borderWidth);
 	parent.canvas.setLineColor(color2);
 	parent.canvas.setBrushColor(color1);
-	parent.canvas.beginDropShadow();
-	parent.canvas.setDropShadowBlur(2 * offset);
-	parent.canvas.setDropShadowColor(color3);
-	parent.canvas.setDropShadowOffset(Geom::Point(0, offset));
-	Gfx::Draw::InfoBubble{parent.canvas,
-	    bubble,
-	    *parent.style.borderRadius,
-	    *parent.style.arrowSize,
-	    arrow};
-	parent.canvas.endDropShadow();
+	if (parent.dropShadows) {
+		parent.canvas.beginDropShadow();
+		parent.canvas.setDropShadowBlur(2 * offset);
+		parent.canvas.setDropShadowColor(color3);
+		parent.canvas.setDropShadowOffset(Geom::Point(0, offset));
+		Gfx::Draw::InfoBubble{parent.canvas,
+		    bubble,
+		    *parent.style.borderRadius,
+		    *parent.style.arrowSize,
+		    arrow};
+		parent.canvas.endDropShadow();
+	}
 	Gfx::Draw::InfoBubble{parent.canvas,
 	    bubble,
 	    *parent.style.borderRadius,
@@ -196,12 +198,14 @@ void drawMarkerInfo::MarkerDC::calculateLayout(Geom::Point hint)
 
 drawMarkerInfo::drawMarkerInfo(const Layout &layout,
     Gfx::ICanvas &canvas,
-    const Gen::Plot &plot) :
+    const Gen::Plot &plot,
+    bool dropShadows) :
     layout(layout),
     canvas(canvas),
     plot(plot),
     coordSystem(nullptr),
-    style(plot.getStyle().tooltip)
+    style(plot.getStyle().tooltip),
+    dropShadows(dropShadows)
 {
 	auto coordSys = Draw::CoordinateSystem(layout.plotArea,
 	    plot.getOptions()->angle,
@@ -45,7 +45,8 @@ public:
 public:
 	drawMarkerInfo(const Layout &layout,
 	    Gfx::ICanvas &canvas,
-	    const Gen::Plot &plot);
+	    const Gen::Plot &plot,
+	    bool dropShadows);
 
 private:
 	const Layout &layout;
@@ -53,6 +54,7 @@ private:
 	const Gen::Plot &plot;
 	Draw::CoordinateSystem *coordSystem;
 	const Styles::Tooltip &style;
+	bool dropShadows;
 
 	void fadeInMarkerInfo(Content &cnt, double weight);
 	void fadeOutMarkerInfo(Content &cnt, double weight);
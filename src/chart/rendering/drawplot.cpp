@@ -14,6 +14,9 @@ using namespace Vizzu::Gen;
 
 drawPlot::drawPlot(const DrawingContext &context) :
     DrawingContext(context)
+{}
+
+void drawPlot::drawBase()
 {
 	drawBackground(layout.plot,
 	    canvas,
@@ -23,7 +26,10 @@ drawPlot::drawPlot(const DrawingContext &context) :
 
 	drawArea(false);
 	drawAxes(*this).drawBase();
+}
 
+void drawPlot::drawContent()
+{
 	auto clip = style.plot.overflow == Styles::Overflow::hidden;
 
 	if (clip) clipPlotArea();
@@ -33,8 +39,11 @@ drawPlot::drawPlot(const DrawingContext &context) :
 	drawMarkers();
 
 	if (clip) canvas.restore();
+}
 
-	drawMarkerLabels();
+void drawPlot::drawLabels()
+{
+	if (quality.markerLabels) drawMarkerLabels();
 
 	drawAxes(*this).drawLabels();
 }
@@ -53,7 +62,7 @@ void drawPlot::drawArea(bool clip)
 	    Geom::Point(1.0, 0.0)};
 	painter.setPolygonToCircleFactor(0.0);
 	painter.setPolygonStraightFactor(0.0);
-	painter.setResMode(ResolutionMode::High);
+	painter.setResMode(quality.resolution);
 
 	if (clip) { painter.drawPolygon(points, true); }
 	else {
@@ -99,8 +108,22 @@ void drawPlot::drawMarkerGuides()
 
 void drawPlot::drawMarkers()
 {
+	// batching reorders the markers and skips their draw events
+	auto batching = quality.markerBatching && !*events.plot.marker.base
+	             && !options.shapeType.contains(Gen::ShapeType::line);
+
+	if (!batching) {
+		for (const auto &marker : plot.getMarkers())
+			drawItem(marker, *this).draw();
+		return;
+	}
+
+	MarkerBatches batches;
 	for (const auto &marker : plot.getMarkers())
-		drawItem(marker, *this).draw();
+		drawItem(marker, *this).draw(batches);
+
+	painter.setResMode(quality.resolution);
+	batches.draw(painter);
 }
 
 void drawPlot::drawMarkerLabels()
@@ -15,6 +15,13 @@ class drawPlot : private DrawingContext
 public:
 	explicit drawPlot(const DrawingContext &context);
 
+	/** Plot background, plot area and axes. */
+	void drawBase();
+	/** Marker guides and bodies, clipped if overflow is hidden. */
+	void drawContent();
+	/** Marker and axis labels. */
+	void drawLabels();
+
 private:
 	void drawArea(bool clip);
 	void clipPlotArea();
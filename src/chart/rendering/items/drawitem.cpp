@@ -136,7 +136,7 @@ Geom::Line DrawItem::getLabelPos(
 	return Geom::Line(res);
 }
 
-bool DrawItem::bounds(const Geom::Point &point)
+bool DrawItem::bounds(const Geom::Point &point) const
 {
 	if (static_cast<double>(enabled) == 0) return false;
 
@@ -162,6 +162,52 @@ bool DrawItem::bounds(const Geom::Point &point)
 	return isInside != false;
 }
 
+std::optional<Geom::Rect> DrawItem::hitBoundary() const
+{
+	auto boundary = getBoundary().positive();
+
+	// covers the tolerance of the quadrilateral containment test
+	auto res = boundary.outline(Geom::Size::Square(
+	    0.01 * std::max(boundary.width(), boundary.height())));
+
+	if (shapeType.contains(Gen::ShapeType::circle))
+		res = res.boundary(Geom::Circle(boundary,
+		    Geom::Circle::FromRect::sameWidth)
+		                       .boundary());
+
+	if (shapeType.contains(Gen::ShapeType::line)) {
+		// line widths are in pixels, in polar space unbounded
+		if (coordSys.getPolar() != false) return std::nullopt;
+		res = res.boundary(lineBoundary());
+	}
+
+	return res;
+}
+
+Geom::Rect DrawItem::lineBoundary() const
+{
+	auto line = getLine();
+
+	auto pBeg = coordSys.convert(line.begin);
+	auto pEnd = coordSys.convert(line.end);
+	auto width = std::max(lineWidth[0], lineWidth[1])
+	           * coordSys.getRect().size.minSize();
+
+	// the hit test quadrilateral and its 10% area tolerance
+	auto distance = 1.5 * width + 0.15 * (pEnd - pBeg).abs();
+
+	auto center = (pBeg + pEnd) / 2.0;
+	auto origo = coordSys.getOriginal(center);
+	auto dx = coordSys.getOriginal(center + Geom::Point(distance, 0))
+	        - origo;
+	auto dy = coordSys.getOriginal(center + Geom::Point(0, distance))
+	        - origo;
+
+	Geom::Size margin(std::abs(dx.x) + std::abs(dy.x),
+	    std::abs(dx.y) + std::abs(dy.y));
+	return Geom::Rect(line).positive().outline(margin);
+}
+
 Geom::ConvexQuad DrawItem::lineToQuad() const
 {
 	auto line = getLine();
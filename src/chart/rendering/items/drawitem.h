@@ -3,6 +3,7 @@
 
 #include <array>
 #include <memory>
+#include <optional>
 
 #include "base/geom/line.h"
 #include "base/geom/rect.h"
@@ -45,7 +46,10 @@ public:
 	Geom::Rect dataRect;
 	double radius;
 
-	bool bounds(const Geom::Point &);
+	bool bounds(const Geom::Point &) const;
+	/** Relative rectangle outside of which bounds() never holds,
+	 *  nullopt if it cannot be determined. */
+	std::optional<Geom::Rect> hitBoundary() const;
 	Geom::Rect getBoundary() const;
 	Geom::Line getLine() const;
 	Geom::Line getStick() const;
@@ -69,6 +73,7 @@ protected:
 
 private:
 	Geom::ConvexQuad lineToQuad() const;
+	Geom::Rect lineBoundary() const;
 };
 
 class SingleDrawItem : public DrawItem
@@ -0,0 +1,55 @@
+#include "drawitemcache.h"
+
+#include <stdexcept>
+#include <utility>
+
+using namespace Vizzu;
+using namespace Vizzu::Draw;
+
+void DrawItemCache::update(const Gen::Plot &plot,
+    const Geom::Rect &plotArea)
+{
+	auto markers = plot.shareMarkers();
+	if (this->plot == &plot && this->markers->sharesWith(markers)
+	    && this->plotArea == plotArea)
+		return;
+
+	invalidate();
+	this->plot = &plot;
+	this->markers = std::move(markers);
+	this->plotArea = plotArea;
+
+	const auto &options = *plot.getOptions();
+	coordSys = CoordinateSystem(plotArea,
+	    options.angle,
+	    options.polar,
+	    plot.keepAspectRatio);
+}
+
+void DrawItemCache::invalidate()
+{
+	plot = nullptr;
+	markers.reset();
+	for (auto &lineItems : items) lineItems.clear();
+}
+
+const DrawItem &DrawItemCache::get(const Gen::Marker &marker,
+    size_t lineIndex)
+{
+	if (!plot) throw std::logic_error("no plot to draw");
+
+	const auto &markers = plot->getMarkers();
+	auto &lineItems = items.at(lineIndex);
+	if (lineItems.size() != markers.size())
+		lineItems.resize(markers.size());
+
+	auto &item = lineItems.at(marker.idx);
+	if (!item)
+		item.emplace(DrawItem::createInterpolated(marker,
+		    *plot->getOptions(),
+		    plot->getStyle(),
+		    coordSys,
+		    markers,
+		    lineIndex));
+	return *item;
+}
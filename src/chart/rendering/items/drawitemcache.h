@@ -0,0 +1,50 @@
+#ifndef ITEM_DRAWITEMCACHE_H
+#define ITEM_DRAWITEMCACHE_H
+
+#include <array>
+#include <optional>
+#include <vector>
+
+#include "chart/rendering/items/drawitem.h"
+
+namespace Vizzu
+{
+namespace Draw
+{
+
+/**
+ * Blended draw items of the markers of a plot, computed once per
+ * marker and line index and shared by the drawing passes and
+ * hit-testing until the plot or its area changes. The items refer to
+ * the markers, so they are also dropped when the markers of the plot
+ * are changed in place and thereby detached from the storage the
+ * items were computed from.
+ */
+class DrawItemCache
+{
+public:
+	DrawItemCache() = default;
+	DrawItemCache(const DrawItemCache &) = delete;
+	DrawItemCache &operator=(const DrawItemCache &) = delete;
+
+	/** Keeps the cached items only if they belong to the same plot
+	 *  and markers drawn into the same area. */
+	void update(const Gen::Plot &plot, const Geom::Rect &plotArea);
+	/** Drops the cached items, e.g. on in-place change of the plot. */
+	void invalidate();
+
+	const DrawItem &get(const Gen::Marker &marker, size_t lineIndex);
+	const CoordinateSystem &getCoordSys() const { return coordSys; }
+
+private:
+	const Gen::Plot *plot{};
+	std::optional<Type::CopyOnWrite<Gen::Plot::Markers>> markers;
+	Geom::Rect plotArea;
+	CoordinateSystem coordSys;
+	std::array<std::vector<std::optional<DrawItem>>, 2> items;
+};
+
+}
+}
+
+#endif
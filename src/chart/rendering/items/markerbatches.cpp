@@ -0,0 +1,92 @@
+#include "markerbatches.h"
+
+using namespace Vizzu;
+using namespace Vizzu::Draw;
+
+void MarkerBatches::add(const Style &style,
+    const DrawItem &item,
+    const std::optional<Geom::Rect> &bounds)
+{
+	getGroup(style, bounds).shapes.push_back({item.points,
+	    static_cast<double>(item.morphToCircle),
+	    static_cast<double>(item.linear),
+	    item.marker.idx,
+	    false});
+}
+
+void MarkerBatches::add(const Style &style, const Geom::Rect &rect)
+{
+	getGroup(style, rect).shapes.push_back({{rect.bottomLeft(),
+	                                      rect.topLeft(),
+	                                      rect.topRight(),
+	                                      rect.bottomRight()},
+	    0.0,
+	    0.0,
+	    0,
+	    true});
+}
+
+void MarkerBatches::draw(Painter &painter) const
+{
+	auto &canvas = painter.getCanvas();
+
+	for (const auto &group : groups) {
+		canvas.setLineColor(group.style.line);
+		canvas.setLineWidth(group.style.width);
+		canvas.setBrushColor(group.style.brush);
+
+		painter.beginPolygonGroup();
+		for (const auto &shape : group.shapes) {
+			if (shape.rect) {
+				for (const auto &point : shape.points)
+					canvas.addPoint(point);
+				canvas.closeSubpath();
+			}
+			else {
+				painter.setPolygonToCircleFactor(shape.circ);
+				painter.setPolygonStraightFactor(shape.linear);
+				painter.drawPolygon(shape.points, false, shape.id);
+			}
+		}
+		painter.endPolygonGroup();
+	}
+	canvas.setLineWidth(0);
+}
+
+MarkerBatches::Group &MarkerBatches::getGroup(const Style &style,
+    const std::optional<Geom::Rect> &bounds)
+{
+	std::array<double, 9> key{style.line.red,
+	    style.line.green,
+	    style.line.blue,
+	    style.line.alpha,
+	    style.brush.red,
+	    style.brush.green,
+	    style.brush.blue,
+	    style.brush.alpha,
+	    style.width};
+
+	auto [it, inserted] = groupIndices.try_emplace(key, groups.size());
+	for (auto i = it->second + 1; !inserted && i < groups.size(); i++)
+		if (groups[i].overlaps(bounds)) {
+			it->second = groups.size();
+			inserted = true;
+		}
+
+	if (inserted) groups.push_back({style, {}, {}, {}});
+
+	auto &group = groups[it->second];
+	if (!bounds)
+		group.unbounded = true;
+	else
+		group.bounds =
+		    group.bounds ? group.bounds->boundary(*bounds) : *bounds;
+	return group;
+}
+
+bool MarkerBatches::Group::overlaps(
+    const std::optional<Geom::Rect> &rect) const
+{
+	if (unbounded || (!rect && !shapes.empty())) return true;
+	return rect && bounds && bounds->intersects(*rect);
+}
@@ -0,0 +1,85 @@
+#ifndef ITEM_MARKERBATCHES_H
+#define ITEM_MARKERBATCHES_H
+
+#include <array>
+#include <cstdint>
+#include <map>
+#include <optional>
+#include <vector>
+
+#include "base/geom/rect.h"
+#include "base/gfx/color.h"
+#include "chart/rendering/painter/painter.h"
+
+#include "drawitem.h"
+
+namespace Vizzu
+{
+namespace Draw
+{
+
+/**
+ * Marker bodies grouped by their line color, brush color and line
+ * width. Each group is drawn as one path, so the canvas state is set
+ * and the path is filled once per group instead of once per marker.
+ * Groups keep the order of their first marker, markers keep their
+ * order within the group. A marker overlapping a marker of a later
+ * group starts a new group of its style, so overlapping markers are
+ * drawn in their original order. Markers without known bounds (e.g.
+ * in polar coordinates) are taken as overlapping every other.
+ */
+class MarkerBatches
+{
+public:
+	struct Style
+	{
+		Gfx::Color line;
+		Gfx::Color brush;
+		double width;
+	};
+
+	/** Adds a marker body; bounds are in canvas coordinates and
+	 *  include the border. */
+	void add(const Style &style,
+	    const DrawItem &item,
+	    const std::optional<Geom::Rect> &bounds);
+	/** Adds a rectangle given in canvas coordinates. */
+	void add(const Style &style, const Geom::Rect &rect);
+
+	void draw(Painter &painter) const;
+
+	size_t groupCount() const { return groups.size(); }
+	bool empty() const { return groups.empty(); }
+
+private:
+	struct Shape
+	{
+		std::array<Geom::Point, 4> points;
+		double circ;
+		double linear;
+		uint64_t id;
+		bool rect;
+	};
+
+	struct Group
+	{
+		Style style;
+		std::vector<Shape> shapes;
+		std::optional<Geom::Rect> bounds;
+		bool unbounded{};
+
+		bool overlaps(const std::optional<Geom::Rect> &rect) const;
+	};
+
+	std::vector<Group> groups;
+	/** Index of the last group of each style. */
+	std::map<std::array<double, 9>, size_t> groupIndices;
+
+	Group &getGroup(const Style &style,
+	    const std::optional<Geom::Rect> &bounds);
+};
+
+}
+}
+
+#endif
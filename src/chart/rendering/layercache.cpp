@@ -0,0 +1,295 @@
+#include "layercache.h"
+
+#include <utility>
+
+#include "base/gfx/displaylistcanvas.h"
+#include "chart/rendering/painter/painter.h"
+
+using namespace Vizzu;
+using namespace Vizzu::Draw;
+
+namespace
+{
+
+class LayerCanvas : public Gfx::DisplayListCanvas, public Painter
+{
+public:
+	using Gfx::DisplayListCanvas::DisplayListCanvas;
+
+	Gfx::ICanvas &getCanvas() override { return *this; }
+
+	void *getPainter() override
+	{
+		return static_cast<Painter *>(this);
+	}
+};
+
+bool handled(const Util::EventDispatcher::event_ptr &event)
+{
+	return event && *event;
+}
+
+bool sameRects(const Layout &layout, const Layout &other)
+{
+	return layout.boundary == other.boundary
+	    && layout.title == other.title
+	    && layout.legend == other.legend
+	    && layout.plot == other.plot
+	    && layout.plotArea == other.plotArea
+	    && layout.xTitle == other.xTitle
+	    && layout.yTitle == other.yTitle;
+}
+
+size_t index(Layer layer) { return static_cast<size_t>(layer); }
+
+}
+
+LayerState::Base::Base(const Gen::Plot &plot) :
+    options(*plot.getOptions()),
+    style(plot.getStyleRevision()),
+    axises(plot.axises),
+    dimensionAxises(plot.dimensionAxises),
+    guidesX(plot.guides.x),
+    guidesY(plot.guides.y)
+{}
+
+bool LayerState::Base::matches(const Gen::Plot &plot) const
+{
+	return style == plot.getStyleRevision()
+	    && options == *plot.getOptions() && axises == plot.axises
+	    && dimensionAxises == plot.dimensionAxises
+	    && guidesX == plot.guides.x && guidesY == plot.guides.y;
+}
+
+bool LayerState::Base::operator==(const Base &other) const
+{
+	return style == other.style && options == other.options
+	    && axises == other.axises
+	    && dimensionAxises == other.dimensionAxises
+	    && guidesX == other.guidesX && guidesY == other.guidesY;
+}
+
+LayerState::LayerState(const Gen::Plot &plot,
+    const Layout &layout,
+    const Quality &quality,
+    const Events::Draw &events,
+    bool animating) :
+    LayerState(plot, layout, quality, events, animating, LayerState())
+{}
+
+LayerState::LayerState(const Gen::Plot &plot,
+    const Layout &layout,
+    const Quality &quality,
+    const Events::Draw &events,
+    bool animating,
+    const LayerState &prev) :
+    valid(true),
+    base(prev.base && prev.base->matches(plot)
+             ? prev.base
+             : std::make_shared<const Base>(plot)),
+    anySelected(static_cast<double>(plot.anySelected)),
+    anyAxisSet(static_cast<double>(plot.anyAxisSet)),
+    keepAspectRatio(static_cast<double>(plot.keepAspectRatio)),
+    layout(layout),
+    quality(quality)
+{
+	if (!animating) {
+		markers = plot.shareMarkers();
+		markersInfo = plot.shareMarkersInfo();
+	}
+
+	const auto &axis = events.plot.axis;
+	auto anyAxisEvent = handled(axis.base) || handled(axis.title)
+	                 || handled(axis.label) || handled(axis.tick)
+	                 || handled(axis.guide)
+	                 || handled(axis.interlacing);
+
+	observed[index(Layer::background)] =
+	    handled(events.background) || handled(events.plot.background)
+	    || handled(events.plot.area) || anyAxisEvent;
+
+	observed[index(Layer::markers)] =
+	    handled(events.plot.marker.base)
+	    || handled(events.plot.marker.guide);
+
+	observedFrame = handled(events.begin) || handled(events.logo)
+	             || handled(events.complete);
+
+	const auto &legend = events.legend;
+	observed[index(Layer::labels)] =
+	    handled(events.plot.marker.label) || anyAxisEvent
+	    || handled(legend.background) || handled(legend.title)
+	    || handled(legend.label) || handled(legend.marker)
+	    || handled(legend.bar) || handled(events.title);
+}
+
+std::array<bool, layerCount> LayerState::changedSince(
+    const LayerState &prev) const
+{
+	auto base = sameBase(prev);
+	auto content = base && sameMarkers(prev);
+
+	std::array<bool, layerCount> res{};
+	res[index(Layer::background)] = !base;
+	res[index(Layer::markers)] =
+	    !content
+	    || quality.markerBatching != prev.quality.markerBatching;
+	res[index(Layer::labels)] =
+	    !content
+	    || quality.markerLabels != prev.quality.markerLabels
+	    || quality.interlacingLabels
+	           != prev.quality.interlacingLabels;
+	res[index(Layer::overlays)] =
+	    !content || !markersInfo || !prev.markersInfo
+	    || !markersInfo->sharesWith(*prev.markersInfo)
+	    || quality.dropShadows != prev.quality.dropShadows;
+	return res;
+}
+
+bool LayerState::cacheable(Layer layer) const
+{
+	if (!valid || observed[index(layer)]) return false;
+	return layer == Layer::background || markers.has_value();
+}
+
+bool LayerState::repaintable() const
+{
+	if (!valid || observedFrame) return false;
+	for (auto i = 0u; i < layerCount; i++)
+		if (!cacheable(static_cast<Layer>(i))) return false;
+	return true;
+}
+
+bool LayerState::sameBase(const LayerState &prev) const
+{
+	return valid && prev.valid
+	    && (base == prev.base || *base == *prev.base)
+	    && anyAxisSet == prev.anyAxisSet
+	    && keepAspectRatio == prev.keepAspectRatio
+	    && sameRects(layout, prev.layout)
+	    && quality.resolution == prev.quality.resolution;
+}
+
+bool LayerState::sameMarkers(const LayerState &prev) const
+{
+	return markers && prev.markers
+	    && markers->sharesWith(*prev.markers)
+	    && anySelected == prev.anySelected;
+}
+
+void LayerCache::update(LayerState state)
+{
+	auto changed = state.changedSince(this->state);
+	for (auto i = 0u; i < layerCount; i++)
+		entries[i].changed = changed[i];
+	this->state = std::move(state);
+}
+
+void LayerCache::invalidate()
+{
+	state = LayerState();
+	for (auto &entry : entries) {
+		entry.changed = true;
+		entry.commands.reset();
+		entry.items.reset();
+	}
+	damage.reset();
+}
+
+void LayerCache::draw(Gfx::ICanvas &canvas,
+    const std::array<DrawLayer, layerCount> &drawLayers)
+{
+	damage.reset();
+
+	if (!repaintable() || !canvas.canReplay()) {
+		for (auto i = 0u; i < layerCount; i++)
+			draw(canvas, static_cast<Layer>(i), drawLayers[i]);
+		return;
+	}
+
+	std::optional<Geom::Rect> changed;
+	auto unite = [&](const std::optional<Geom::Rect> &bounds)
+	{
+		if (bounds)
+			changed = changed ? changed->boundary(*bounds) : *bounds;
+	};
+
+	for (auto i = 0u; i < layerCount; i++) {
+		auto &entry = entries[i];
+		if (!entry.changed) continue;
+		unite(entry.items->bounds());
+		record(canvas, entry, drawLayers[i]);
+		unite(entry.items->bounds());
+	}
+
+	// anti-aliased edges overhang the drawn shapes
+	auto area = changed ? changed->outline(Geom::Size::Square(2))
+	                    : Geom::Rect();
+
+	if (!canvas.repaintArea(area)) {
+		for (const auto &entry : entries)
+			canvas.replay(*entry.commands);
+		return;
+	}
+
+	damage = area;
+	if (!changed) return;
+
+	canvas.save();
+	canvas.setClipRect(area);
+	for (const auto &entry : entries)
+		canvas.replay(entry.items->select(*entry.commands, area));
+	canvas.restore();
+}
+
+void LayerCache::draw(Gfx::ICanvas &canvas,
+    Layer layer,
+    const DrawLayer &drawLayer)
+{
+	auto &entry = at(layer);
+
+	if (isCached(layer) && canvas.replay(*entry.commands)) return;
+
+	entry.commands.reset();
+	entry.items.reset();
+
+	if (!state.cacheable(layer) || !canvas.canReplay()) {
+		drawLayer(canvas);
+		return;
+	}
+
+	record(canvas, entry, drawLayer);
+	canvas.replay(*entry.commands);
+}
+
+bool LayerCache::isCached(Layer layer) const
+{
+	const auto &entry = entries[index(layer)];
+	return !entry.changed && entry.commands && state.cacheable(layer);
+}
+
+LayerCache::Entry &LayerCache::at(Layer layer)
+{
+	return entries[index(layer)];
+}
+
+bool LayerCache::repaintable() const
+{
+	if (!state.repaintable()
+	    || entries[index(Layer::background)].changed)
+		return false;
+	for (const auto &entry : entries)
+		if (!entry.commands) return false;
+	return true;
+}
+
+void LayerCache::record(Gfx::ICanvas &canvas,
+    Entry &entry,
+    const DrawLayer &drawLayer)
+{
+	LayerCanvas recorder(&canvas);
+	drawLayer(recorder);
+	entry.commands = std::move(recorder.getDisplayList());
+	entry.items.emplace(*entry.commands);
+	entry.changed = false;
+}
@@ -0,0 +1,157 @@
+#ifndef CHART_RENDERING_LAYERCACHE_H
+#define CHART_RENDERING_LAYERCACHE_H
+
+#include <array>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <optional>
+
+#include "base/gfx/canvas.h"
+#include "base/gfx/displaylist.h"
+#include "base/gfx/displaylistindex.h"
+#include "chart/generator/plot.h"
+#include "chart/main/events.h"
+#include "chart/main/layout.h"
+
+#include "quality.h"
+
+namespace Vizzu
+{
+namespace Draw
+{
+
+/**
+ * Parts of a frame in drawing order: backgrounds with the plot area
+ * and the axes; marker guides and bodies; marker and axis labels with
+ * the legend and the title; marker info tooltips.
+ */
+enum class Layer : size_t { background, markers, labels, overlays };
+
+constexpr size_t layerCount = 4;
+
+/**
+ * Snapshot of everything the layers of a frame are drawn from. The
+ * snapshot of the previous frame tells which layers changed.
+ * The plot properties the background is drawn from are copied only
+ * when they differ from the previous frame; otherwise the copy of the
+ * previous state is shared. The style is compared by its revision.
+ * Markers are compared by the identity of their storage; while an
+ * animation runs they change on every frame, so they are not kept.
+ * Layers with draw event handlers are never cached, as the handlers
+ * may draw themselves or skip elements.
+ */
+class LayerState
+{
+public:
+	LayerState() = default;
+	LayerState(const Gen::Plot &plot,
+	    const Layout &layout,
+	    const Quality &quality,
+	    const Events::Draw &events,
+	    bool animating);
+	/** Shares the copied plot properties of the previous state if the
+	 *  plot still has the same ones. */
+	LayerState(const Gen::Plot &plot,
+	    const Layout &layout,
+	    const Quality &quality,
+	    const Events::Draw &events,
+	    bool animating,
+	    const LayerState &prev);
+
+	/** Layers drawn differently than after the previous state. */
+	std::array<bool, layerCount> changedSince(
+	    const LayerState &prev) const;
+	bool cacheable(Layer layer) const;
+	/** Every layer can be cached and no frame level draw event is
+	 *  handled, so the frame can be repainted partially. */
+	bool repaintable() const;
+
+private:
+	struct Base
+	{
+		Gen::Options options;
+		Styles::Revision style;
+		Gen::Axises axises;
+		Gen::DimensionAxises dimensionAxises;
+		Gen::GuidesByAxis guidesX;
+		Gen::GuidesByAxis guidesY;
+
+		explicit Base(const Gen::Plot &plot);
+		bool matches(const Gen::Plot &plot) const;
+		bool operator==(const Base &other) const;
+	};
+
+	bool valid{};
+	std::shared_ptr<const Base> base;
+	double anySelected{};
+	double anyAxisSet{};
+	double keepAspectRatio{};
+	Layout layout;
+	Quality quality;
+	std::optional<Type::CopyOnWrite<Gen::Plot::Markers>> markers;
+	std::optional<Type::CopyOnWrite<Gen::Plot::MarkersInfo>>
+	    markersInfo;
+	std::array<bool, layerCount> observed{};
+	bool observedFrame{};
+
+	bool sameBase(const LayerState &prev) const;
+	bool sameMarkers(const LayerState &prev) const;
+};
+
+/**
+ * Display lists of the layers of the last frame. Unchanged layers are
+ * replayed instead of drawn again on canvases able to replay display
+ * lists; other canvases get every layer drawn. On canvases keeping
+ * the previous frame, only the area covered by the changed layers in
+ * the previous or the actual frame is repainted, with the items of
+ * the layers intersecting it.
+ */
+class LayerCache
+{
+public:
+	typedef std::function<void(Gfx::ICanvas &)> DrawLayer;
+
+	/** Starts a frame drawn from the given state. */
+	void update(LayerState state);
+	const LayerState &getState() const { return state; }
+	void invalidate();
+
+	/** Draws the layers of a frame in order. */
+	void draw(Gfx::ICanvas &canvas,
+	    const std::array<DrawLayer, layerCount> &drawLayers);
+	void draw(Gfx::ICanvas &canvas,
+	    Layer layer,
+	    const DrawLayer &drawLayer);
+
+	bool isCached(Layer layer) const;
+	/** Area repainted in the last frame; nullopt if the whole frame
+	 *  was drawn. */
+	const std::optional<Geom::Rect> &getDamage() const
+	{
+		return damage;
+	}
+
+private:
+	struct Entry
+	{
+		bool changed{true};
+		std::optional<Gfx::DisplayList> commands;
+		std::optional<Gfx::DisplayListIndex> items;
+	};
+
+	LayerState state;
+	std::array<Entry, layerCount> entries;
+	std::optional<Geom::Rect> damage;
+
+	Entry &at(Layer layer);
+	bool repaintable() const;
+	void record(Gfx::ICanvas &canvas,
+	    Entry &entry,
+	    const DrawLayer &drawLayer);
+};
+
+}
+}
+
+#endif
@@ -1,6 +1,8 @@
 #include "coordinatesystem.h"
 
+#include <algorithm>
 #include <cmath>
+#include <stdexcept>
 
 #include "base/math/interpolation.h"
 
@@ -42,6 +44,40 @@ Point PolarDescartesTransform::convert(const Point &p) const
 		return converted;
 }
 
+void PolarDescartesTransform::convert(std::span<const Point> ps,
+    std::span<Point> res) const
+{
+	if (ps.size() != res.size())
+		throw std::logic_error("point count mismatch");
+
+	if (polar == 0.0) {
+		if (ps.data() != res.data())
+			std::copy(ps.begin(), ps.end(), res.begin());
+		return;
+	}
+
+	auto mapped = mappedSize();
+	auto usedAngle =
+	    Math::interpolate(0.0, 2.0 * M_PI, static_cast<double>(polar));
+	auto hEquidist = mapped.area() / M_PI;
+	auto yCircTop = 1.0 - mapped.y;
+	auto radius = mapped.x / usedAngle - hEquidist;
+	Point center(0.5, yCircTop - radius);
+
+	auto zoomFactor = 1.0;
+	if (zoomOut) {
+		zoomFactor = static_cast<double>(polar) - 0.5;
+		zoomFactor = 0.75 + zoomFactor * zoomFactor;
+	}
+	auto offset = Point(.5, .5) + (center - Point(.5, .5)) * zoomFactor;
+
+	for (auto i = 0u; i < ps.size(); i++) {
+		auto angle = M_PI / 2.0 + (0.5 - ps[i].x) * usedAngle;
+		auto r = (radius + ps[i].y * mapped.y) * zoomFactor;
+		res[i] = offset + Point(r * cos(angle), r * sin(angle));
+	}
+}
+
 double PolarDescartesTransform::horConvert(double length) const
 {
 	return mappedSize().x * length;
@@ -137,6 +173,26 @@ Point CompoundTransform::convert(const Point &p) const
 	return rect.pos + rect.size * Point(aligned.x, 1 - aligned.y);
 }
 
+void CompoundTransform::convert(std::span<const Point> ps,
+    std::span<Point> res) const
+{
+	PolarDescartesTransform::convert(ps, res);
+
+	auto aligned = alignedSize();
+	auto xx = rect.size.x * aligned.x * cosAngle;
+	auto xy = -rect.size.x * aligned.x * sinAngle;
+	auto yx = -rect.size.y * aligned.y * sinAngle;
+	auto yy = -rect.size.y * aligned.y * cosAngle;
+	auto x0 = rect.pos.x + rect.size.x * 0.5;
+	auto y0 = rect.pos.y + rect.size.y * 0.5;
+
+	for (auto &p : res) {
+		auto x = p.x - 0.5;
+		auto y = p.y - 0.5;
+		p = Point(x0 + xx * x + xy * y, y0 + yx * x + yy * y);
+	}
+}
+
 Line CompoundTransform::convertDirectionAt(const Line &vec) const
 {
 	const auto small = .00000000001;
@@ -181,6 +237,16 @@ Point CompoundTransform::getOriginal(const Point &p) const
 
 Rect CompoundTransform::getRect() const { return rect; }
 
+bool CompoundTransform::similar(const CompoundTransform &other) const
+{
+	return zoomOut == other.zoomOut
+	    && static_cast<double>(polar) == static_cast<double>(other.polar)
+	    && angle == other.angle
+	    && static_cast<double>(keepAspectRatio)
+	           == static_cast<double>(other.keepAspectRatio)
+	    && rect.size.aspectRatio() == other.rect.size.aspectRatio();
+}
+
 Point CompoundTransform::justRotate(const Point &p) const
 {
 	return rotate(p, true, Geom::Point());
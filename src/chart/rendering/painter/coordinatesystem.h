@@ -1,6 +1,8 @@
 #ifndef COORDINATESYSTEM_H
 #define COORDINATESYSTEM_H
 
+#include <span>
+
 #include "base/geom/rect.h"
 #include "base/math/fuzzybool.h"
 
@@ -15,6 +17,10 @@ public:
 	PolarDescartesTransform() = default;
 	PolarDescartesTransform(Math::FuzzyBool polar);
 	Geom::Point convert(const Geom::Point &p) const;
+	/** Converts the points in one pass with the parameters of the
+	 *  polar mapping computed once; \p res may alias \p ps. */
+	void convert(std::span<const Geom::Point> ps,
+	    std::span<Geom::Point> res) const;
 	double horConvert(double length) const;
 	double verConvert(double length) const;
 	Geom::Point getOriginal(const Geom::Point &p) const;
@@ -37,6 +43,10 @@ public:
 	    Math::FuzzyBool polar,
 	    Math::FuzzyBool keepAspectRatio);
 	Geom::Point convert(const Geom::Point &p) const;
+	/** Batch version of convert(); rotation, alignment and the
+	 *  mapping into the rectangle are merged into one affine step. */
+	void convert(std::span<const Geom::Point> ps,
+	    std::span<Geom::Point> res) const;
 	double horConvert(double length) const;
 	double verConvert(double length) const;
 	Geom::Line convertDirectionAt(const Geom::Line &vec) const;
@@ -44,6 +54,10 @@ public:
 	Geom::Rect getRect() const;
 	double getAngle() const;
 	Geom::Point justRotate(const Geom::Point &p) const;
+	/** True if the two differ only in the position and the scale of
+	 *  their rectangle, i.e. converted points relative to the
+	 *  rectangle are the same. */
+	bool similar(const CompoundTransform &other) const;
 
 private:
 	Geom::Rect rect;
@@ -101,3 +101,12 @@ Point drawLine::Path::getPoint(double i)
 	return drawOptions.coordSys.convert(
 	    Math::interpolate<>(p0, p1, i));
 }
+
+void drawLine::Path::getPoints(std::span<const double> is,
+    std::span<Point> points)
+{
+	for (auto i = 0u; i < is.size(); i++)
+		points[i] = Math::interpolate<>(p0, p1, is[i]);
+
+	drawOptions.coordSys.convert(points, points);
+}
@@ -46,6 +46,8 @@ private:
 		Geom::Point lastPoint;
 		void addPoint(const Geom::Point &point) override;
 		Geom::Point getPoint(double i) override;
+		void getPoints(std::span<const double> is,
+		    std::span<Geom::Point> points) override;
 	};
 };
 
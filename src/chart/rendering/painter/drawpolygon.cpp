@@ -21,7 +21,8 @@ drawPolygon::drawPolygon(const std::array<Point, 4> &ps,
 	auto linSize = Size(options.coordSys.verConvert(boundary.x),
 	    options.coordSys.verConvert(boundary.y));
 
-	if (options.circ == 1.0 && linSize.isSquare(0.005)) {
+	if (options.circ == 1.0 && linSize.isSquare(0.005)
+	    && !options.subpath) {
 		auto centerConv = options.coordSys.convert(center);
 		auto radius = fabs(linSize.x) / 2.0;
 		Geom::Circle circle(centerConv, radius);
@@ -31,14 +32,16 @@ drawPolygon::drawPolygon(const std::array<Point, 4> &ps,
 			canvas.circle(circle);
 	}
 	else {
-		canvas.beginPolygon();
+		if (!options.subpath) canvas.beginPolygon();
 
 		Path(ps[0], ps[1], center, linSize, canvas, options).calc();
 		Path(ps[1], ps[2], center, linSize, canvas, options).calc();
 		Path(ps[2], ps[3], center, linSize, canvas, options).calc();
 		Path(ps[3], ps[0], center, linSize, canvas, options).calc();
 
-		if (clip)
+		if (options.subpath)
+			canvas.closeSubpath();
+		else if (clip)
 			canvas.setClipPolygon();
 		else
 			canvas.endPolygon();
@@ -63,6 +66,7 @@ drawPolygon::Path::Path(const Point &p0,
 
 void drawPolygon::Path::addPoint(const Point &point)
 {
+	if (options.outline) options.outline->push_back(point);
 	canvas.addPoint(point);
 }
 
@@ -77,6 +81,22 @@ Point drawPolygon::Path::getPoint(double f)
 	return intpToElipse(mixedP, options.circ);
 }
 
+void drawPolygon::Path::getPoints(std::span<const double> fs,
+    std::span<Point> points)
+{
+	for (auto i = 0u; i < fs.size(); i++)
+		points[i] = Math::interpolate(p0, p1, fs[i]);
+
+	options.coordSys.convert(points, points);
+
+	for (auto i = 0u; i < fs.size(); i++) {
+		auto linP = Math::interpolate(linP0, linP1, fs[i]);
+		auto mixedP =
+		    Math::interpolate(points[i], linP, options.linear);
+		points[i] = intpToElipse(mixedP, options.circ);
+	}
+}
+
 Point drawPolygon::Path::intpToElipse(Point point, double factor)
 {
 	auto projected = projectToElipse(point);
@@ -24,10 +24,17 @@ public:
 		Options(CoordinateSystem &coordSys) :
 		    PathSampler::Options(coordSys),
 		    circ(0),
-		    linear(0)
+		    linear(0),
+		    outline(nullptr),
+		    subpath(false)
 		{}
 		double circ;
 		double linear;
+		/** Receives the sampled points if set. */
+		std::vector<Geom::Point> *outline;
+		/** Adds the outline as a closed subpath of the polygon being
+		 *  drawn on the canvas instead of drawing it on its own. */
+		bool subpath;
 	};
 
 	drawPolygon(const std::array<Geom::Point, 4> &ps,
@@ -58,6 +65,8 @@ private:
 
 		void addPoint(const Geom::Point &point) override;
 		Geom::Point getPoint(double f) override;
+		void getPoints(std::span<const double> fs,
+		    std::span<Geom::Point> points) override;
 
 		Geom::Point intpToElipse(Geom::Point point, double factor);
 
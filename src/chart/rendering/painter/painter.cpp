@@ -26,12 +26,56 @@ void Painter::drawStraightLine(const Geom::Line &line,
 	    getCanvas());
 }
 
+void Painter::beginPolygonGroup()
+{
+	getCanvas().beginPolygon();
+	grouped = true;
+}
+
+void Painter::endPolygonGroup()
+{
+	grouped = false;
+	getCanvas().endPolygon();
+}
+
 void Painter::drawPolygon(
     const std::array<Geom::Point, 4> &ps,
-    bool clip)
+    bool clip,
+    std::optional<uint64_t> cacheId)
 {
 	Draw::drawPolygon::Options options(system);
 	options.circ = polygonOptions.toCircleFactor;
 	options.linear = polygonOptions.straightFactor;
+	options.subpath = grouped && !clip;
+
+	if (!pathCache || !cacheId) {
+		Draw::drawPolygon(ps, options, getCanvas(), clip);
+		return;
+	}
+
+	PathCache::Key key{ps, options.circ, options.linear};
+	if (const auto *outline = pathCache->find(*cacheId, key, system)) {
+		auto &canvas = getCanvas();
+		if (!options.subpath) canvas.beginPolygon();
+		for (const auto &point : *outline)
+			canvas.addPoint(PathCache::fromRelative(system, point));
+		if (options.subpath)
+			canvas.closeSubpath();
+		else if (clip)
+			canvas.setClipPolygon();
+		else
+			canvas.endPolygon();
+		return;
+	}
+
+	if (!pathCache->shouldRecord(*cacheId)) {
+		Draw::drawPolygon(ps, options, getCanvas(), clip);
+		return;
+	}
+
+	std::vector<Geom::Point> outline;
+	options.outline = &outline;
 	Draw::drawPolygon(ps, options, getCanvas(), clip);
+	// drawn as a circle primitive if empty, nothing to reuse
+	if (!outline.empty()) pathCache->insert(*cacheId, system, outline);
 }
@@ -3,8 +3,12 @@
 
 #include "base/gfx/canvas.h"
 
+#include <cstdint>
+#include <optional>
+
 #include "coordinatesystem.h"
 #include "painteroptions.h"
+#include "pathcache.h"
 
 namespace Vizzu
 {
@@ -26,6 +30,7 @@ public:
 	{
 		this->mode = mode;
 	}
+	void setPathCache(PathCache *cache) { pathCache = cache; }
 
 	void drawLine(const Geom::Line &line);
 
@@ -44,8 +49,16 @@ public:
 		polygonOptions.straightFactor = factor;
 	}
 
+	/** Polygons drawn between these two calls are added to one path,
+	 *  filled and stroked once with the actual canvas state. */
+	void beginPolygonGroup();
+	void endPolygonGroup();
+
+	/** Polygons with cache id reuse their sampled outline while
+	 *  unchanged. */
 	void drawPolygon(const std::array<Geom::Point, 4> &ps,
-	    bool clip = false);
+	    bool clip = false,
+	    std::optional<uint64_t> cacheId = std::nullopt);
 
 private:
 	struct PolygonOptions
@@ -57,6 +70,8 @@ private:
 	CoordinateSystem system;
 	ResolutionMode mode;
 	PolygonOptions polygonOptions;
+	PathCache *pathCache{};
+	bool grouped{};
 };
 
 }
@@ -0,0 +1,66 @@
+#include "pathcache.h"
+
+using namespace Vizzu;
+using namespace Vizzu::Draw;
+
+const std::vector<Geom::Point> *PathCache::find(uint64_t id,
+    const Key &key,
+    const CoordinateSystem &coordSys)
+{
+	auto &entry = entries[id];
+
+	if (entry.recorded && entry.key == key
+	    && reusable(entry.coordSys, coordSys))
+		return &entry.points;
+
+	entry.repeated = entry.requested && entry.key == key
+	              && entry.coordSys.similar(coordSys);
+	entry.requested = true;
+	entry.recorded = false;
+	entry.key = key;
+	entry.coordSys = coordSys;
+	return nullptr;
+}
+
+bool PathCache::shouldRecord(uint64_t id) const
+{
+	auto it = entries.find(id);
+	return it != entries.end() && it->second.repeated;
+}
+
+void PathCache::insert(uint64_t id,
+    const CoordinateSystem &coordSys,
+    const std::vector<Geom::Point> &points)
+{
+	auto &entry = entries[id];
+	entry.coordSys = coordSys;
+	entry.points.clear();
+	for (const auto &point : points)
+		entry.points.push_back(toRelative(coordSys, point));
+	entry.recorded = true;
+}
+
+/**
+ * Outlines are sampled with pixel based tolerances, so they are reused
+ * for at most twice the size they were sampled for.
+ */
+bool PathCache::reusable(const CoordinateSystem &recorded,
+    const CoordinateSystem &actual)
+{
+	return recorded.similar(actual)
+	    && actual.getRect().size.x <= 2 * recorded.getRect().size.x;
+}
+
+Geom::Point PathCache::toRelative(const CoordinateSystem &coordSys,
+    const Geom::Point &point)
+{
+	const auto &rect = coordSys.getRect();
+	return (point - rect.pos) / rect.size;
+}
+
+Geom::Point PathCache::fromRelative(const CoordinateSystem &coordSys,
+    const Geom::Point &point)
+{
+	const auto &rect = coordSys.getRect();
+	return rect.pos + point * rect.size;
+}
@@ -0,0 +1,76 @@
+#ifndef PATHCACHE_H
+#define PATHCACHE_H
+
+#include <array>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+#include "base/geom/point.h"
+
+#include "coordinatesystem.h"
+
+namespace Vizzu
+{
+namespace Draw
+{
+
+/**
+ * Sampled polygon outlines by id (marker index), stored relative to the
+ * rectangle of the coordinate system, so that they can be re-emitted
+ * after the rectangle moved or was scaled. An outline is recorded only
+ * when the same polygon is requested the second time in a row, which
+ * keeps animated shapes out of the cache.
+ */
+class PathCache
+{
+public:
+	struct Key
+	{
+		std::array<Geom::Point, 4> points;
+		double circ{};
+		double linear{};
+
+		bool operator==(const Key &other) const = default;
+	};
+
+	/** The cached outline in relative coordinates or nullptr.
+	 *  Registers the request for recording on a miss. */
+	const std::vector<Geom::Point> *find(uint64_t id,
+	    const Key &key,
+	    const CoordinateSystem &coordSys);
+	/** Whether the outline of the last missed request should be
+	 *  passed to insert(). */
+	bool shouldRecord(uint64_t id) const;
+	void insert(uint64_t id,
+	    const CoordinateSystem &coordSys,
+	    const std::vector<Geom::Point> &points);
+	void clear() { entries.clear(); }
+	size_t size() const { return entries.size(); }
+
+	static Geom::Point toRelative(const CoordinateSystem &coordSys,
+	    const Geom::Point &point);
+	static Geom::Point fromRelative(const CoordinateSystem &coordSys,
+	    const Geom::Point &point);
+
+private:
+	struct Entry
+	{
+		Key key;
+		CoordinateSystem coordSys;
+		bool requested{};
+		bool repeated{};
+		bool recorded{};
+		std::vector<Geom::Point> points;
+	};
+
+	std::unordered_map<uint64_t, Entry> entries;
+
+	static bool reusable(const CoordinateSystem &recorded,
+	    const CoordinateSystem &actual);
+};
+
+}
+}
+
+#endif
@@ -0,0 +1,59 @@
+#include "quality.h"
+
+using namespace Vizzu;
+using namespace Vizzu::Draw;
+
+Quality Quality::ofLevel(size_t level)
+{
+	Quality res;
+	if (level >= 1) res.resolution = ResolutionMode::Low;
+	if (level >= 2) res.dropShadows = false;
+	if (level >= 3) res.interlacingLabels = false;
+	if (level >= 4) res.markerLabels = false;
+	return res;
+}
+
+QualityController::QualityController(Duration frameBudget) :
+    frameBudget(frameBudget)
+{}
+
+const Quality &QualityController::beginFrame(bool animating)
+{
+	this->animating = animating;
+	if (!animating && level != 0) {
+		fastFrames = 0;
+		setLevel(0);
+	}
+	return quality;
+}
+
+void QualityController::endFrame(Duration frameTime)
+{
+	if (!animating) return;
+
+	if (frameTime > frameBudget) {
+		fastFrames = 0;
+		if (level + 1 < levels) setLevel(level + 1);
+	}
+	else if (frameTime < frameBudget * recoveryRatio && level > 0) {
+		if (++fastFrames >= recoveryFrames) {
+			fastFrames = 0;
+			setLevel(level - 1);
+		}
+	}
+	else
+		fastFrames = 0;
+}
+
+void QualityController::setMarkerBatching(bool enabled)
+{
+	markerBatching = enabled;
+	quality.markerBatching = enabled;
+}
+
+void QualityController::setLevel(size_t newLevel)
+{
+	level = newLevel;
+	quality = Quality::ofLevel(level);
+	quality.markerBatching = markerBatching;
+}
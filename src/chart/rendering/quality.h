@@ -0,0 +1,75 @@
+#ifndef CHART_RENDERING_QUALITY_H
+#define CHART_RENDERING_QUALITY_H
+
+#include <chrono>
+#include <cstddef>
+
+#include "painter/painteroptions.h"
+
+namespace Vizzu
+{
+namespace Draw
+{
+
+struct Quality
+{
+	ResolutionMode resolution{ResolutionMode::High};
+	bool dropShadows{true};
+	bool interlacingLabels{true};
+	bool markerLabels{true};
+	/** Draws the marker bodies grouped by their style, one path per
+	 *  group; only markers not overlapping each other are reordered.
+	 */
+	bool markerBatching{false};
+
+	static Quality ofLevel(size_t level);
+};
+
+/**
+ * Trades rendering quality for frame rate while an animation runs.
+ * Each frame over the budget steps the quality one level down:
+ * coarser path sampling first, then no tooltip shadows, no axis
+ * labels and finally no marker labels. A long enough run of frames
+ * well within the budget steps it back up, and frames drawn at rest
+ * always get full quality.
+ */
+class QualityController
+{
+public:
+	typedef std::chrono::duration<double> Duration;
+
+	static constexpr size_t levels = 5;
+	static constexpr size_t recoveryFrames = 30;
+	static constexpr double recoveryRatio = 0.6;
+
+	explicit QualityController(
+	    Duration frameBudget = Duration(1.0 / 60.0));
+
+	void setFrameBudget(Duration budget) { frameBudget = budget; }
+	Duration getFrameBudget() const { return frameBudget; }
+
+	/** Off by default; set by C++ embedders, the web interface does
+	 *  not expose it. */
+	void setMarkerBatching(bool enabled);
+
+	const Quality &beginFrame(bool animating);
+	void endFrame(Duration frameTime);
+
+	const Quality &get() const { return quality; }
+	size_t getLevel() const { return level; }
+
+private:
+	Duration frameBudget;
+	size_t level{};
+	size_t fastFrames{};
+	bool animating{};
+	bool markerBatching{};
+	Quality quality;
+
+	void setLevel(size_t newLevel);
+};
+
+}
+}
+
+#endif
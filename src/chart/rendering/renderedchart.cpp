@@ -7,6 +7,7 @@ using namespace Vizzu::Draw;
 void RenderedChart::addElement(DrawingElement &&element)
 {
 	elements.push_back(std::move(element));
+	index.reset();
 }
 
 void Vizzu::Draw::RenderedChart::hintAddElementCount(size_t count)
@@ -16,8 +17,17 @@ void Vizzu::Draw::RenderedChart::hintAddElementCount(size_t count)
 
 const DrawingElement &RenderedChart::findElement(const Geom::Point &point) const
 {
-	for (auto &element : std::ranges::reverse_view(elements))
-		if (element.rect.contains(point))
-			return element;
+	if (!index) {
+		std::vector<std::optional<Geom::Rect>> boundaries;
+		boundaries.reserve(elements.size());
+		for (const auto &element : elements)
+			boundaries.emplace_back(element.rect);
+		index.emplace(boundaries);
+	}
+
+	auto candidates = index->find(point);
+	for (auto i : std::ranges::reverse_view(candidates))
+		if (elements[i].rect.contains(point))
+			return elements[i];
 	return elements.front();
-}
\ No newline at end of file
+}
@@ -3,9 +3,11 @@
 
 #include <vector>
 #include <concepts>
+#include <optional>
 
 #include "base/geom/affinetransform.h"
 #include "base/geom/rect.h"
+#include "base/geom/spatialindex.h"
 #include "base/util/eventdispatcher.h"
 
 #include "chart/rendering/painter/coordinatesystem.h"
@@ -43,6 +45,7 @@ public:
 private:
 	CoordinateSystem coordinateSystem;
 	std::vector<DrawingElement> elements;
+	mutable std::optional<Geom::SpatialIndex> index;
 
 };
 
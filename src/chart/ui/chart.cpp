@@ -193,7 +193,7 @@ void ChartWidget::updateCursor()
 void ChartWidget::trackMarker()
 {
 	auto plot = chart.getPlot();
-	if (trackedMarkerId == -1 && plot) {
+	if (plot) {
 		auto clickedMarker = chart.markerAt(pointerEvent.pos);
 		if (clickedMarker) {
 			trackedMarkerId = clickedMarker->idx;
@@ -223,7 +223,9 @@ void ChartWidget::trackMarker()
 				    }
 				    trackedMarkerId = -1;
 			    },
-			    now);
+			    now,
+			    GUI::Scheduler::Priority::high,
+			    &trackedMarkerId);
 		}
 		else {
 			trackedMarkerId = -1;
@@ -15,6 +15,9 @@ DataCube::DataCube(const DataTable &table,
 	    && options.getSeries().empty())
 		return;
 
+	if (options.getDimensions().size() > maxDimensions)
+		throw std::logic_error("too many dimensions in data cube");
+
 	MultiIndex sizes;
 	for (auto idx : options.getDimensions()) {
 		auto size =
@@ -64,6 +67,7 @@ MultiIndex DataCube::getIndex(const TableRow<double> &row,
     size_t rowIndex)
 {
 	MultiIndex index;
+	index.reserve(indices.size());
 	for (auto idx : indices) {
 		auto indexValue =
 		    idx.getType().isReal() ? row[idx.getColIndex()]
@@ -135,12 +139,12 @@ SubSliceIndex DataCube::inverseSubSliceIndex(
 	SubSliceIndex subSliceIndex;
 	subSliceIndex.reserve(multiIndex.size());
 
-	std::set<DimIndex> dimIndices;
+	uint64_t dimMask = 0;
 	for (auto colIndex : colIndices)
-		dimIndices.insert(getDimBySeries(colIndex));
+		dimMask |= uint64_t{1} << getDimBySeries(colIndex);
 
 	for (auto i = 0u; i < multiIndex.size(); i++)
-		if (dimIndices.find(DimIndex(i)) == dimIndices.end())
+		if ((dimMask & (uint64_t{1} << i)) == 0)
 			subSliceIndex.push_back({DimIndex(i), multiIndex[i]});
 
 	return subSliceIndex;
@@ -158,6 +162,24 @@ size_t DataCube::combinedSizeOf(const SeriesList &colIndices) const
 	return combinedIndexOf(colIndices, data.maxIndex()) + 1;
 }
 
+SubSliceIndex DataCube::subSliceIndexOf(const SeriesList &colIndices,
+    size_t combinedIndex) const
+{
+	auto maxIndex = data.maxIndex();
+
+	SubSliceIndex subSliceIndex;
+	for (auto colIndex : colIndices)
+		subSliceIndex.push_back({getDimBySeries(colIndex), Index(0)});
+
+	for (auto i = subSliceIndex.size(); i-- > 0;) {
+		auto &slice = subSliceIndex[i];
+		auto size = static_cast<size_t>(maxIndex[slice.dimIndex]) + 1;
+		slice.index = Index(combinedIndex % size);
+		combinedIndex /= size;
+	}
+	return subSliceIndex;
+}
+
 Aggregator DataCube::aggregateAt(const MultiIndex &multiIndex,
     const SeriesList &sumCols,
     SeriesIndex seriesId) const
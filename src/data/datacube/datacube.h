@@ -42,6 +42,9 @@ class DataCube
 public:
 	typedef MultiDim::Array<DataCubeCell> Data;
 
+	/** Dimension indices are tracked in 64 bit masks. */
+	static constexpr std::size_t maxDimensions = 64;
+
 	DataCube() : table(nullptr) {}
 
 	DataCube(const DataTable &table,
@@ -59,6 +62,10 @@ public:
 
 	size_t combinedSizeOf(const SeriesList &colIndices) const;
 
+	MultiDim::SubSliceIndex subSliceIndexOf(
+	    const SeriesList &colIndices,
+	    size_t combinedIndex) const;
+
 	Aggregator aggregateAt(const MultiDim::MultiIndex &multiIndex,
 	    const SeriesList &sumCols,
 	    SeriesIndex seriesId) const;
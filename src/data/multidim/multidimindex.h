@@ -4,6 +4,7 @@
 #include <vector>
 
 #include "base/text/smartstring.h"
+#include "base/type/smallvector.h"
 #include "base/type/uniquetype.h"
 
 namespace Vizzu
@@ -21,7 +22,11 @@ struct IndexTypeId
 {};
 typedef Type::UniqueType<uint64_t, IndexTypeId> Index;
 
-typedef std::vector<Index> MultiIndex;
+/** Dimension count kept inline by the index types without
+ *  allocating, larger indices fall back to the heap. */
+constexpr std::size_t inlineDimensions = 6;
+
+typedef Type::SmallVector<Index, inlineDimensions> MultiIndex;
 
 static inline std::string to_string(const MultiIndex &multiIndex)
 {
@@ -62,7 +67,8 @@ struct SliceIndex
 	}
 };
 
-class SubSliceIndex : public std::vector<SliceIndex>
+class SubSliceIndex :
+    public Type::SmallVector<SliceIndex, inlineDimensions>
 {
 public:
 	SubSliceIndex() {}
@@ -118,7 +124,11 @@ public:
 	{
 		typedef Text::SmartString S;
 		return "[ "
-		     + S::join<std::vector, SliceIndex>(*this,
+		     + S::join(S::map(*this,
+		                   [](const SliceIndex &index)
+		                   {
+			                   return std::string(index);
+		                   }),
 		         std::string(", "))
 		     + " ]";
 	}
@@ -132,7 +142,8 @@ public:
 	}
 };
 static_assert(sizeof(SubSliceIndex)
-                  == sizeof(std::vector<SliceIndex>),
+                  == sizeof(Type::SmallVector<SliceIndex,
+                      inlineDimensions>),
     "");
 
 }
@@ -3,7 +3,7 @@
 using namespace Vizzu;
 using namespace Data;
 
-DataTable::DataTable() {}
+DataTable::DataTable() : version(0) {}
 
 void DataTable::pushRow(const std::span<const char *> &cells)
 {
@@ -20,6 +20,7 @@ void DataTable::pushRow(const TableRow<std::string> &textRow)
 			    infos[i].registerValue(textRow[ColumnIndex(i)]));
 	}
 	addRow(row);
+	version++;
 }
 
 template <typename T>
@@ -27,6 +28,8 @@ DataTable::DataIndex DataTable::addTypedColumn(
     const std::string &name,
     const std::span<T> &values)
 {
+	version++;
+
 	TextType type;
 	if constexpr (std::is_same_v<T, double>)
 		type = TextType::Number;
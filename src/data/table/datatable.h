@@ -58,9 +58,14 @@ public:
 
 	size_t columnCount() const;
 
+	/** Incremented on every modification of the table content. */
+	uint64_t getVersion() const { return version; }
+
 private:
 	typedef std::vector<ColumnInfo> Infos;
 
+	uint64_t version;
+
 	std::map<std::string, ColumnIndex> indexByName;
 	Infos infos;
 
@@ -96,9 +96,11 @@ void TestChart::run()
 		setter->deleteSeries(ChannelId::y, "Cat2");
 		setter->addSeries(ChannelId::x, "Cat2");
 		setter->setTitle("VIZZU Chart - Phase 3");
-		chart.getChart().getStyles().title.textAlign =
+		auto styles = chart.getChart().getStyles();
+		styles.title.textAlign =
 		    ::Anim::Interpolated<Styles::Text::TextAlign>(
 		        Styles::Text::TextAlign::right);
+		chart.getChart().setStyles(styles);
 		chart.getChart().setKeyframe();
 		chart.getChart().animate(step4);
 	};
@@ -112,12 +114,14 @@ void TestChart::run()
 		setter->addSeries(ChannelId::color, "Cat2");
 		setter->setPolar(true);
 		setter->setTitle("VIZZU Chart - Phase 2");
-		chart.getChart().getStyles().title.fontSize = 10;
-		chart.getChart().getStyles().legend.marker.type =
+		auto styles = chart.getChart().getStyles();
+		styles.title.fontSize = 10;
+		styles.legend.marker.type =
 		    Styles::Legend::Marker::Type::square;
-		chart.getChart().getStyles().title.textAlign =
+		styles.title.textAlign =
 		    ::Anim::Interpolated<Styles::Text::TextAlign>(
 		        Styles::Text::TextAlign::center);
+		chart.getChart().setStyles(styles);
 		chart.getChart().setKeyframe();
 		chart.getChart().animate(step3);
 	};
@@ -136,11 +140,13 @@ void TestChart::run()
 			    },
 			    0));
 			setter->setTitle("VIZZU Chart - Phase 1b");
-			chart.getChart().getStyles().legend.marker.type =
+			auto styles = chart.getChart().getStyles();
+			styles.legend.marker.type =
 			    Styles::Legend::Marker::Type::circle;
-			chart.getChart().getStyles().title.textAlign =
+			styles.title.textAlign =
 			    ::Anim::Interpolated<Styles::Text::TextAlign>(
 			        Styles::Text::TextAlign::right);
+			chart.getChart().setStyles(styles);
 			chart.getChart().setKeyframe();
 			chart.getChart().animate(step2);
 		}
@@ -160,15 +166,17 @@ void TestChart::run()
 		setter->addSeries(ChannelId::x, "Val");
 		setter->addSeries(ChannelId::y, "Cat2");
 		setter->addSeries(ChannelId::color, "Cat2");
-		chart.getChart().getStyles().plot.marker.label.filter =
+		auto styles = chart.getChart().getStyles();
+		styles.plot.marker.label.filter =
 		    Gfx::ColorTransform::Lightness(0.5);
-		chart.getChart().getStyles().plot.marker.label.position =
+		styles.plot.marker.label.position =
 		    Styles::MarkerLabel::Position::center;
-		chart.getChart().getStyles().legend.marker.type =
+		styles.legend.marker.type =
 		    Styles::Legend::Marker::Type::square;
-		chart.getChart().getStyles().title.textAlign =
+		styles.title.textAlign =
 		    ::Anim::Interpolated<Styles::Text::TextAlign>(
 		        Styles::Text::TextAlign::left);
+		chart.getChart().setStyles(styles);
 		setter->setTitle("Example VIZZU Chart");
 		chart.getChart().setKeyframe();
 		chart.getChart().animate(step1b);
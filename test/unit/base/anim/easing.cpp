@@ -0,0 +1,88 @@
+#include "base/anim/easing.h"
+
+#include <cmath>
+#include <vector>
+
+#include "base/anim/easingfunc.h"
+
+#include "../../util/test.h"
+
+using namespace test;
+
+namespace
+{
+
+double maxDeviation(const Anim::Easing &easing,
+    Anim::EaseFuncBase reference)
+{
+	auto res = 0.0;
+	for (auto i = 0; i <= 1000; i++) {
+		auto x = i / 1000.0;
+		res = std::max(res, std::abs(easing(x) - reference(x)));
+	}
+	return res;
+}
+
+}
+
+static auto tests =
+    collection::add_suite("Anim::Easing")
+
+        .add_case("tabulated_curve_stays_within_max_error",
+            []
+            {
+	            Anim::Easing coarse(&Anim::EaseFunc::sine, 1e-3);
+	            Anim::Easing fine(&Anim::EaseFunc::sine, 1e-6);
+	            check() << coarse.isTabulated() == true;
+	            check() << fine.isTabulated() == true;
+	            check() << maxDeviation(coarse, &Anim::EaseFunc::sine)
+	                <= 1e-3;
+	            check() << maxDeviation(fine, &Anim::EaseFunc::sine)
+	                <= 1e-6;
+            })
+
+        .add_case("cubic_bezier_follows_css_curve",
+            []
+            {
+	            Anim::Easing ease("ease");
+	            Anim::Easing custom("cubic-bezier(0.42, 0, 1, 1)");
+	            check() << ease.isTabulated() == true;
+	            check() << std::abs(ease(0.5) - 0.8024033877) < 1e-3;
+	            check() << std::abs(custom(0.0)) < 1e-9;
+	            check() << std::abs(custom(1.0) - 1.0) < 1e-9;
+            })
+
+        .add_case("cubic_bezier_rejects_control_points_out_of_unit_x",
+            []
+            {
+	            throws<std::logic_error>() << []
+	            {
+		            Anim::Easing("cubic-bezier(-0.5, 0, 1, 1)");
+	            };
+	            throws<std::logic_error>() << []
+	            {
+		            Anim::Easing("cubic-bezier(0, 0, 1.5, 1)");
+	            };
+	            Anim::Easing overshooting("cubic-bezier(0, -1, 1, 2)");
+	            check() << std::abs(overshooting(1.0) - 1.0) < 1e-6;
+            })
+
+        .add_case("steps_are_evaluated_directly",
+            []
+            {
+	            Anim::Easing stepEnd("step-end");
+	            check() << stepEnd.isTabulated() == false;
+	            check() << stepEnd(0.999) == 0.0;
+	            check() << stepEnd(1.0) == 1.0;
+            })
+
+        .add_case("batch_evaluation_equals_single_calls",
+            []
+            {
+	            Anim::Easing easing("ease-in-out");
+	            std::vector<double> factors{-0.5, 0, 0.1, 0.5, 0.77, 1, 2};
+	            auto expected = factors;
+	            for (auto &x : expected) x = easing(x);
+	            easing(factors);
+	            check() << (factors == expected) == true;
+            });
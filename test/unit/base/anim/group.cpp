@@ -0,0 +1,66 @@
+#include "base/anim/group.h"
+
+#include <memory>
+
+#include "../../util/test.h"
+
+using namespace test;
+using namespace std::chrono_literals;
+
+namespace
+{
+
+struct Counter : Anim::IElement
+{
+	int &calls;
+	explicit Counter(int &calls) : calls(calls) {}
+	void transform(double) override { calls++; }
+};
+
+struct Timeline : Anim::Group
+{
+	using Anim::Group::setPosition;
+};
+
+}
+
+static auto tests =
+    collection::add_suite("Anim::Group")
+
+        .add_case("unchanged_factors_are_not_reapplied",
+            []
+            {
+	            int first = 0;
+	            int delayed = 0;
+	            Timeline timeline;
+	            timeline.addElement(std::make_unique<Counter>(first),
+	                Anim::Options(1s));
+	            timeline.addElement(std::make_unique<Counter>(delayed),
+	                Anim::Options(1s, 2s));
+
+	            timeline.setPosition(500ms);
+	            auto dirtyWhileRunning = timeline.isDirty();
+	            timeline.setPosition(1500ms);
+	            auto dirtyAfterFirstEnded = timeline.isDirty();
+	            timeline.setPosition(1700ms);
+	            auto dirtyDuringDelay = timeline.isDirty();
+
+	            check() << dirtyWhileRunning == true;
+	            check() << dirtyAfterFirstEnded == true;
+	            check() << dirtyDuringDelay == false;
+	            check() << first == 2;
+	            check() << delayed == 1;
+            })
+
+        .add_case("repeated_position_is_not_reapplied",
+            []
+            {
+	            int calls = 0;
+	            Timeline timeline;
+	            timeline.addElement(std::make_unique<Counter>(calls),
+	                Anim::Options(1s));
+	            timeline.setPosition(0ms);
+	            timeline.setPosition(0ms);
+	            check() << calls == 1;
+	            check() << timeline.isDirty() == false;
+            });
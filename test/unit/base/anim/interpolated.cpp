@@ -0,0 +1,79 @@
+#include "base/anim/interpolated.h"
+
+#include <string>
+
+#include "../../util/allocations.h"
+#include "../../util/test.h"
+
+using namespace test;
+
+namespace
+{
+
+bool same(const Anim::String &a, const Anim::String &b)
+{
+	if (a.count != b.count) return false;
+	for (auto i = 0u; i < a.count; i++)
+		if (a.values[i].value != b.values[i].value
+		    || a.values[i].weight != b.values[i].weight)
+			return false;
+	return true;
+}
+
+}
+
+static auto tests =
+    collection::add_suite("Anim::Interpolated")
+
+        .add_case("interpolate_into_matches_interpolate",
+            []
+            {
+	            Anim::String from(std::string(40, 'a'));
+	            Anim::String to(std::string(40, 'b'));
+	            Anim::String res;
+	            auto matches = true;
+	            for (auto factor : {0.0, 0.25, 0.5, 1.0, 0.75, 0.0}) {
+		            Anim::interpolateInto(res, from, to, factor);
+		            matches = matches
+		                   && same(res,
+		                       Anim::interpolate(from, to, factor));
+	            }
+	            Anim::interpolateInto(res, from, from, 0.5);
+	            matches =
+	                matches
+	                && same(res, Anim::interpolate(from, from, 0.5));
+
+	            check() << matches == true;
+	            check() << res.count == 1u;
+            })
+
+        .add_case("single_values_copy_without_second_slot",
+            []
+            {
+	            Anim::String value(std::string(40, 'a'));
+	            Anim::String copy;
+
+	            allocations allocs;
+	            copy = value;
+	            auto count = allocs.count();
+
+	            check() << count == 1u;
+	            check() << copy.get() == value.get();
+            })
+
+        .add_case("reinterpolation_does_not_allocate",
+            []
+            {
+	            Anim::String from(std::string(40, 'a'));
+	            Anim::String to(std::string(40, 'b'));
+	            Anim::String res;
+	            Anim::interpolateInto(res, from, to, 0.5);
+
+	            allocations allocs;
+	            for (auto i = 1; i < 100; i++)
+		            Anim::interpolateInto(res, from, to, i / 100.0);
+	            auto count = allocs.count();
+
+	            check() << count == 0u;
+	            check() << res.values[1].value == to.get();
+            });
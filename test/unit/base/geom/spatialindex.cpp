@@ -0,0 +1,82 @@
+#include "base/geom/spatialindex.h"
+
+#include <random>
+
+#include "../../util/test.h"
+
+using namespace test;
+
+static auto tests =
+    collection::add_suite("Geom::SpatialIndex")
+
+        .add_case("candidates_include_every_containing_rect",
+            []
+            {
+	            std::mt19937 gen(42);
+	            std::uniform_real_distribution<double> pos(0, 1);
+	            std::uniform_real_distribution<double> size(0, 0.1);
+
+	            std::vector<std::optional<Geom::Rect>> rects;
+	            for (auto i = 0; i < 1000; i++)
+		            rects.emplace_back(Geom::Rect(Geom::Point(pos(gen),
+		                                              pos(gen)),
+		                Geom::Point(size(gen), size(gen))));
+	            Geom::SpatialIndex index(rects);
+
+	            auto missed = 0;
+	            auto candidates = 0u;
+	            for (auto i = 0; i < 1000; i++) {
+		            Geom::Point point(pos(gen), pos(gen));
+		            auto found = index.find(point);
+		            candidates += found.size();
+		            for (auto j = 0u; j < rects.size(); j++)
+			            if (rects[j]->contains(point)
+			                && !std::binary_search(found.begin(),
+			                    found.end(),
+			                    j))
+				            missed++;
+	            }
+
+	            check() << missed == 0;
+	            check() << (candidates < 1000u * 50u) == true;
+            })
+
+        .add_case("unbounded_items_are_candidates_everywhere",
+            []
+            {
+	            std::vector<std::optional<Geom::Rect>> rects{
+	                Geom::Rect(0, 0, 1, 1),
+	                std::nullopt,
+	                Geom::Rect(0.5, 0.5, 1, 1)};
+	            Geom::SpatialIndex index(rects);
+
+	            auto inside = index.find(Geom::Point(0.7, 0.7));
+	            auto outside = index.find(Geom::Point(5, 5));
+
+	            check() << inside == std::vector<size_t>{0, 1, 2};
+	            check() << outside == std::vector<size_t>{1};
+            })
+
+        .add_case("area_query_finds_every_intersecting_rect",
+            []
+            {
+	            std::vector<std::optional<Geom::Rect>> rects{
+	                Geom::Rect(0, 0, 1, 1),
+	                Geom::Rect(2, 2, 1, 1),
+	                std::nullopt,
+	                Geom::Rect(9, 9, 1, 1)};
+	            Geom::SpatialIndex index(rects);
+
+	            auto found = index.find(Geom::Rect(0.5, 0.5, 2, 2));
+	            auto outside = index.find(Geom::Rect(20, 20, 1, 1));
+
+	            check() << found == std::vector<size_t>{0, 1, 2};
+	            check() << outside == std::vector<size_t>{2};
+            })
+
+        .add_case("empty_index_finds_nothing",
+            []
+            {
+	            Geom::SpatialIndex index;
+	            check() << index.find(Geom::Point()).empty() == true;
+            });
@@ -0,0 +1,60 @@
+#include "base/gfx/displaylist.h"
+
+#include "../../util/test.h"
+
+using namespace test;
+
+using Op = Gfx::DisplayList::Op;
+
+static auto tests =
+    collection::add_suite("Gfx::DisplayList")
+
+        .add_case("commands_are_opcodes_followed_by_arguments",
+            []
+            {
+	            Gfx::DisplayList list;
+	            list.add(Op::save);
+	            list.add(Op::line, {1, 2, 3, 4});
+	            list.append({5});
+
+	            std::vector<float> expected{
+	                static_cast<float>(Op::save),
+	                static_cast<float>(Op::line),
+	                1,
+	                2,
+	                3,
+	                4,
+	                5};
+	            check() << list.getCommands() == expected;
+            })
+
+        .add_case("strings_are_stored_once_and_referenced_by_index",
+            []
+            {
+	            Gfx::DisplayList list;
+	            list.add(Op::setFont, {}, "12px Roboto");
+	            list.add(Op::text, {0, 0, 10, 10}, "label");
+	            list.add(Op::setFont, {}, "12px Roboto");
+
+	            const auto &commands = list.getCommands();
+	            check() << list.getStrings().size() == 2u;
+	            check() << commands[1] == 0.0f;
+	            check() << commands[7] == 1.0f;
+	            check() << commands[9] == 0.0f;
+	            check() << std::string(list.getStringPointers()[1])
+	                == "label";
+            })
+
+        .add_case("clear_drops_commands_and_strings",
+            []
+            {
+	            Gfx::DisplayList list;
+	            list.add(Op::text, {0, 0, 10, 10}, "first");
+	            list.clear();
+	            auto empty = list.empty();
+	            list.add(Op::text, {0, 0, 10, 10}, "second");
+
+	            check() << empty == true;
+	            check() << list.getStrings().size() == 1u;
+	            check() << list.getCommands()[5] == 0.0f;
+            });
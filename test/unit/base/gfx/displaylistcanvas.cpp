@@ -0,0 +1,119 @@
+#include "base/gfx/displaylistcanvas.h"
+
+#include "../../util/test.h"
+
+using namespace test;
+
+using Op = Gfx::DisplayList::Op;
+
+namespace
+{
+
+class TestCanvas : public Gfx::DisplayListCanvas
+{
+public:
+	void *getPainter() override { return nullptr; }
+};
+
+std::vector<float> opcodes(const Gfx::DisplayList &list,
+    std::initializer_list<size_t> positions)
+{
+	std::vector<float> res;
+	for (auto position : positions)
+		res.push_back(list.getCommands().at(position));
+	return res;
+}
+
+}
+
+static auto tests =
+    collection::add_suite("Gfx::DisplayListCanvas")
+
+        .add_case("unchanged_states_are_not_recorded",
+            []
+            {
+	            TestCanvas canvas;
+	            canvas.setLineWidth(2);
+	            canvas.setLineWidth(2);
+	            canvas.setBrushColor(Gfx::Color(1, 0, 0));
+	            canvas.setBrushColor(Gfx::Color(1, 0, 0));
+
+	            std::vector<float> expected{
+	                static_cast<float>(Op::setLineWidth),
+	                2,
+	                static_cast<float>(Op::setBrushColor),
+	                1,
+	                0,
+	                0,
+	                1};
+	            check() << canvas.getDisplayList().getCommands()
+	                == expected;
+            })
+
+        .add_case("states_are_recorded_again_after_restore",
+            []
+            {
+	            TestCanvas canvas;
+	            canvas.setLineWidth(2);
+	            canvas.save();
+	            canvas.restore();
+	            canvas.setLineWidth(2);
+
+	            const auto &list = canvas.getDisplayList();
+	            check() << list.getCommands().size() == 6u;
+	            check() << opcodes(list, {0, 2, 3, 4})
+	                == std::vector<float>{
+	                    static_cast<float>(Op::setLineWidth),
+	                    static_cast<float>(Op::save),
+	                    static_cast<float>(Op::restore),
+	                    static_cast<float>(Op::setLineWidth)};
+            })
+
+        .add_case("text_color_is_recorded_as_brush",
+            []
+            {
+	            TestCanvas canvas;
+	            canvas.setTextColor(Gfx::Color(0, 1, 0));
+	            canvas.setBrushColor(Gfx::Color(0, 1, 0));
+
+	            const auto &list = canvas.getDisplayList();
+	            check() << list.getCommands().size() == 5u;
+	            check() << opcodes(list, {0})
+	                == std::vector<float>{
+	                    static_cast<float>(Op::setBrushColor)};
+            })
+
+        .add_case("frame_begin_clears_commands_and_states",
+            []
+            {
+	            TestCanvas canvas;
+	            canvas.setLineWidth(2);
+	            canvas.frameBegin();
+	            canvas.setLineWidth(2);
+
+	            check() << canvas.getDisplayList().getCommands().size()
+	                == 2u;
+            })
+
+        .add_case("replayed_list_is_appended_and_resets_states",
+            []
+            {
+	            TestCanvas recorder;
+	            recorder.rectangle(Geom::Rect(0, 0, 1, 1));
+	            TestCanvas canvas;
+	            canvas.setLineWidth(2);
+
+	            auto replayed =
+	                canvas.replay(recorder.getDisplayList());
+	            canvas.setLineWidth(2);
+
+	            const auto &list = canvas.getDisplayList();
+	            check() << canvas.canReplay() == true;
+	            check() << replayed == true;
+	            check() << list.getCommands().size() == 9u;
+	            check() << opcodes(list, {0, 2, 7})
+	                == std::vector<float>{
+	                    static_cast<float>(Op::setLineWidth),
+	                    static_cast<float>(Op::rectangle),
+	                    static_cast<float>(Op::setLineWidth)};
+            });
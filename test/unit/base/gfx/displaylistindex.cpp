@@ -0,0 +1,113 @@
+#include "base/gfx/displaylistindex.h"
+
+#include "base/geom/affinetransform.h"
+#include "base/gfx/displaylistcanvas.h"
+
+#include "../../util/test.h"
+
+using namespace test;
+
+using Op = Gfx::DisplayList::Op;
+
+namespace
+{
+
+class TestCanvas : public Gfx::DisplayListCanvas
+{
+public:
+	void *getPainter() override { return nullptr; }
+};
+
+float op(Op op) { return static_cast<float>(op); }
+
+}
+
+static auto tests =
+    collection::add_suite("Gfx::DisplayListIndex")
+
+        .add_case("items_outside_of_the_area_are_skipped",
+            []
+            {
+	            TestCanvas canvas;
+	            canvas.setBrushColor(Gfx::Color(1, 0, 0));
+	            canvas.rectangle(Geom::Rect(0, 0, 1, 1));
+	            canvas.setBrushColor(Gfx::Color(0, 0, 1));
+	            canvas.rectangle(Geom::Rect(10, 10, 1, 1));
+	            const auto &list = canvas.getDisplayList();
+
+	            Gfx::DisplayListIndex index(list);
+	            auto selected =
+	                index.select(list, Geom::Rect(9, 9, 3, 3));
+
+	            std::vector<float> expected{op(Op::setBrushColor),
+	                0,
+	                0,
+	                1,
+	                1,
+	                op(Op::rectangle),
+	                10,
+	                10,
+	                1,
+	                1};
+	            check() << index.size() == 2u;
+	            check() << index.cullable() == true;
+	            check() << selected.getCommands() == expected;
+            })
+
+        .add_case("bounds_are_transformed_and_cover_line_width",
+            []
+            {
+	            TestCanvas canvas;
+	            canvas.setLineWidth(2);
+	            canvas.save();
+	            canvas.transform(
+	                Geom::AffineTransform(Geom::Point(100, 0)));
+	            canvas.rectangle(Geom::Rect(0, 0, 10, 10));
+	            canvas.restore();
+	            canvas.line(Geom::Line(Geom::Point(0, 0),
+	                Geom::Point(10, 0)));
+
+	            Gfx::DisplayListIndex index(canvas.getDisplayList());
+
+	            check() << index.size() == 2u;
+	            check() << (index.bounds()
+	                        == Geom::Rect(-1, -1, 112, 12))
+	                == true;
+            })
+
+        .add_case("texts_keep_their_strings_and_font",
+            []
+            {
+	            TestCanvas canvas;
+	            canvas.setFont(Gfx::Font(10));
+	            canvas.text(Geom::Rect(0, 0, 5, 5), "first");
+	            canvas.text(Geom::Rect(10, 0, 5, 5), "second");
+	            const auto &list = canvas.getDisplayList();
+
+	            auto selected = Gfx::DisplayListIndex(list).select(list,
+	                Geom::Rect(11, 1, 1, 1));
+
+	            const auto &commands = selected.getCommands();
+	            const auto &strings = selected.getStrings();
+	            check() << strings.size() == 2u;
+	            check() << strings[static_cast<size_t>(commands[1])]
+	                == Gfx::Font(10).toCSS();
+	            check() << strings[static_cast<size_t>(commands[7])]
+	                == std::string("second");
+            })
+
+        .add_case("top_level_clip_disables_culling",
+            []
+            {
+	            TestCanvas canvas;
+	            canvas.setClipRect(Geom::Rect(0, 0, 5, 5));
+	            canvas.rectangle(Geom::Rect(0, 0, 1, 1));
+	            const auto &list = canvas.getDisplayList();
+
+	            Gfx::DisplayListIndex index(list);
+	            auto selected =
+	                index.select(list, Geom::Rect(9, 9, 1, 1));
+
+	            check() << index.cullable() == false;
+	            check() << selected.getCommands() == list.getCommands();
+            });
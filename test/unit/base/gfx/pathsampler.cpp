@@ -0,0 +1,140 @@
+#include "base/gfx/pathsampler.h"
+
+#include <cmath>
+#include <functional>
+#include <vector>
+
+#include "base/geom/triangle.h"
+
+#include "../../util/test.h"
+
+using namespace test;
+
+namespace
+{
+
+typedef std::function<Geom::Point(double)> Curve;
+
+class Sampler : public Gfx::PathSampler
+{
+public:
+	Sampler(Curve curve, double dMax, double hMax) :
+	    Gfx::PathSampler(dMax, hMax),
+	    curve(std::move(curve))
+	{}
+
+	std::vector<Geom::Point> sample()
+	{
+		calc();
+		return points;
+	}
+
+	size_t batches{};
+
+private:
+	Curve curve;
+	std::vector<Geom::Point> points;
+
+	void addPoint(const Geom::Point &point) override
+	{
+		points.push_back(point);
+	}
+
+	Geom::Point getPoint(double f) override { return curve(f); }
+
+	void getPoints(std::span<const double> fs,
+	    std::span<Geom::Point> points) override
+	{
+		batches++;
+		Gfx::PathSampler::getPoints(fs, points);
+	}
+};
+
+/** Depth-first bisection as the reference result. */
+void reference(const Curve &curve,
+    double dMax,
+    double hMax,
+    const Geom::Point &pConv0,
+    const Geom::Point &pConv1,
+    double i0,
+    double i1,
+    size_t depth,
+    std::vector<Geom::Point> &res)
+{
+	if (depth >= 20) return;
+
+	auto i = (i0 + i1) / 2.0;
+	auto pConv = curve(i);
+
+	Geom::Triangle triangle(pConv0, pConv, pConv1);
+	auto height = 2 * triangle.area() / (pConv1 - pConv0).abs();
+
+	auto needMore =
+	    height > hMax
+	    || ((pConv1 - pConv0).sqrAbs() < (pConv - pConv0).sqrAbs())
+	    || ((pConv1 - pConv0).sqrAbs() < (pConv - pConv1).sqrAbs());
+
+	if (needMore && (pConv - pConv0).sqrAbs() > dMax)
+		reference(curve, dMax, hMax, pConv0, pConv, i0, i, depth + 1, res);
+
+	res.push_back(pConv);
+
+	if (needMore && (pConv - pConv1).sqrAbs() > dMax)
+		reference(curve, dMax, hMax, pConv, pConv1, i, i1, depth + 1, res);
+}
+
+std::vector<Geom::Point> reference(const Curve &curve,
+    double dMax,
+    double hMax)
+{
+	std::vector<Geom::Point> res{curve(0.0)};
+	reference(curve, dMax, hMax, curve(0.0), curve(1.0), 0, 1, 0, res);
+	res.push_back(curve(1.0));
+	return res;
+}
+
+}
+
+static auto tests =
+    collection::add_suite("Gfx::PathSampler")
+
+        .add_case("samples_match_depth_first_bisection",
+            []
+            {
+	            std::vector<Curve> curves{
+	                [](double f)
+	                {
+		                return Geom::Point::Polar(100, f * 3.0);
+	                },
+	                [](double f)
+	                {
+		                return Geom::Point(f * 200,
+		                    50 * std::sin(f * 20));
+	                },
+	                [](double f)
+	                {
+		                return Geom::Point(f * 10, f * 10);
+	                }};
+
+	            for (const auto &curve : curves) {
+		            Sampler sampler(curve, 1.0, 0.5);
+		            auto points = sampler.sample();
+		            check() << (points == reference(curve, 1.0, 0.5))
+		                == true;
+	            }
+            })
+
+        .add_case("midpoints_of_a_level_are_sampled_in_one_batch",
+            []
+            {
+	            Sampler sampler(
+	                [](double f)
+	                {
+		                return Geom::Point::Polar(100, f * 3.0);
+	                },
+	                1.0,
+	                0.5);
+	            auto points = sampler.sample();
+
+	            check() << (sampler.batches < points.size() / 4) == true;
+            });
@@ -0,0 +1,50 @@
+#include "base/gfx/textmetrics.h"
+
+#include "../../util/test.h"
+
+using namespace test;
+
+static auto tests =
+    collection::add_suite("Gfx::TextMetricsCache")
+
+        .add_case("sizes_are_keyed_by_font_and_text",
+            []
+            {
+	            Gfx::TextMetricsCache cache;
+	            cache.insert("12px Roboto", "label", Geom::Size(30, 12));
+
+	            auto *hit = cache.find("12px Roboto", "label");
+	            auto *otherFont = cache.find("14px Roboto", "label");
+	            auto *otherText = cache.find("12px Roboto", "other");
+
+	            check() << (hit != nullptr) == true;
+	            check() << hit->x == 30.0;
+	            check() << (otherFont == nullptr) == true;
+	            check() << (otherText == nullptr) == true;
+            })
+
+        .add_case("least_recently_used_entry_is_evicted",
+            []
+            {
+	            Gfx::TextMetricsCache cache(2);
+	            cache.insert("font", "a", Geom::Size(1, 1));
+	            cache.insert("font", "b", Geom::Size(2, 1));
+	            cache.find("font", "a");
+	            cache.insert("font", "c", Geom::Size(3, 1));
+
+	            check() << cache.size() == 2u;
+	            check() << (cache.find("font", "a") != nullptr) == true;
+	            check() << (cache.find("font", "b") == nullptr) == true;
+	            check() << (cache.find("font", "c") != nullptr) == true;
+            })
+
+        .add_case("clear_invalidates_all_entries",
+            []
+            {
+	            Gfx::TextMetricsCache cache;
+	            cache.insert("font", "a", Geom::Size(1, 1));
+	            cache.clear();
+
+	            check() << cache.size() == 0u;
+	            check() << (cache.find("font", "a") == nullptr) == true;
+            });
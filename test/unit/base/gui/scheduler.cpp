@@ -0,0 +1,133 @@
+#include "base/gui/scheduler.h"
+
+#include <string>
+
+#include "../../util/test.h"
+
+using namespace test;
+using namespace std::chrono_literals;
+
+namespace
+{
+
+using Priority = GUI::Scheduler::Priority;
+
+auto past() { return GUI::TaskQueue::Clock::now() - 1s; }
+
+}
+
+static auto tests =
+    collection::add_suite("GUI::TaskQueue")
+
+        .add_case("due_tasks_run_by_priority_then_time",
+            []
+            {
+	            GUI::TaskQueue queue;
+	            std::string order;
+	            auto at = past();
+	            queue.schedule(
+	                [&]
+	                {
+		                order += 'b';
+	                },
+	                at + 1ms);
+	            queue.schedule(
+	                [&]
+	                {
+		                order += 'a';
+	                },
+	                at);
+	            queue.schedule(
+	                [&]
+	                {
+		                order += 'h';
+	                },
+	                at + 2ms,
+	                Priority::high);
+	            queue.schedule(
+	                [&]
+	                {
+		                order += 'l';
+	                },
+	                at,
+	                Priority::low);
+	            queue.schedule(
+	                [&]
+	                {
+		                order += 'f';
+	                },
+	                GUI::TaskQueue::Clock::now() + 1h);
+
+	            auto left = queue.poll();
+
+	            check() << order == "habl";
+	            check() << left == false;
+	            check() << queue.size() == 1u;
+            })
+
+        .add_case("poll_yields_when_budget_is_spent",
+            []
+            {
+	            GUI::TaskQueue queue;
+	            auto runs = 0;
+	            for (auto i = 0; i < 3; i++)
+		            queue.schedule(
+		                [&]
+		                {
+			                runs++;
+		                },
+		                past());
+
+	            auto left =
+	                queue.poll(GUI::TaskQueue::Clock::duration(0));
+	            auto afterFirst = runs;
+	            queue.poll();
+
+	            check() << afterFirst == 1;
+	            check() << left == true;
+	            check() << runs == 3;
+            })
+
+        .add_case("tasks_with_same_key_are_coalesced",
+            []
+            {
+	            GUI::TaskQueue queue;
+	            std::string runs;
+	            int key;
+	            auto late = GUI::TaskQueue::Clock::now() + 1h;
+	            queue.schedule(
+	                [&]
+	                {
+		                runs += '1';
+	                },
+	                late,
+	                Priority::low,
+	                &key);
+	            queue.schedule(
+	                [&]
+	                {
+		                runs += '2';
+	                },
+	                past(),
+	                Priority::normal,
+	                &key);
+
+	            auto count = queue.size();
+	            queue.poll();
+
+	            check() << count == 1u;
+	            check() << runs == "2";
+            })
+
+        .add_case("next_deadline_is_the_earliest_pending_task",
+            []
+            {
+	            GUI::TaskQueue queue;
+	            auto empty = !queue.nextDeadline();
+	            auto now = GUI::TaskQueue::Clock::now();
+	            queue.schedule([] {}, now + 2s);
+	            queue.schedule([] {}, now + 1s);
+
+	            check() << empty == true;
+	            check() << (*queue.nextDeadline() == now + 1s) == true;
+            });
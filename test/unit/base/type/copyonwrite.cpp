@@ -0,0 +1,44 @@
+#include "base/type/copyonwrite.h"
+
+#include <vector>
+
+#include "../../util/test.h"
+
+using namespace test;
+
+typedef Type::CopyOnWrite<std::vector<int>> Shared;
+
+static auto tests =
+    collection::add_suite("Type::CopyOnWrite")
+
+        .add_case("copies_share_content_until_written",
+            []
+            {
+	            Shared original(std::vector<int>{1, 2, 3});
+	            auto copy = original;
+	            check() << copy.sharesWith(original) == true;
+	            check() << copy.isShared() == true;
+	            check() << &*copy == &*original;
+            })
+
+        .add_case("write_detaches_only_the_written_copy",
+            []
+            {
+	            Shared original(std::vector<int>{1, 2, 3});
+	            auto copy = original;
+	            copy.write().push_back(4);
+	            check() << copy.sharesWith(original) == false;
+	            check() << copy->size() == 4u;
+	            check() << original->size() == 3u;
+	            check() << original.isShared() == false;
+            })
+
+        .add_case("write_on_unique_content_keeps_storage",
+            []
+            {
+	            Shared value(std::vector<int>{1, 2, 3});
+	            const auto *before = &*value;
+	            value.write()[0] = 5;
+	            check() << &value.write() == before;
+	            check() << (*value)[0] == 5;
+            });
@@ -0,0 +1,89 @@
+#include "base/type/smallvector.h"
+
+#include "../../util/allocations.h"
+#include "../../util/test.h"
+
+using namespace test;
+
+typedef Type::SmallVector<int, 4> Vec;
+
+static auto tests =
+    collection::add_suite("Type::SmallVector")
+
+        .add_case("keeps_elements_inline_up_to_capacity",
+            []
+            {
+	            allocations allocs;
+	            Vec vec;
+	            for (auto i = 0; i < 4; i++) vec.push_back(i);
+	            auto copy = vec;
+	            auto count = allocs.count();
+	            check() << count == 0u;
+	            check() << copy.size() == 4u;
+	            check() << copy.back() == 3;
+	            check() << copy.isInline() == true;
+            })
+
+        .add_case("falls_back_to_heap_above_capacity",
+            []
+            {
+	            Vec vec{1, 2, 3, 4, 5, 6};
+	            check() << vec.isInline() == false;
+	            check() << vec.size() == 6u;
+	            vec.pop_back();
+	            check() << vec.back() == 5;
+	            vec.clear();
+	            check() << vec.isInline() == true;
+	            check() << vec.empty() == true;
+            })
+
+        .add_case("resize_fills_new_elements",
+            []
+            {
+	            Vec vec(2, 7);
+	            vec.resize(3);
+	            check() << vec[2] == 0;
+	            vec.resize(6, 9);
+	            check() << vec[1] == 7;
+	            check() << vec[5] == 9;
+	            vec.resize(1);
+	            check() << vec.size() == 1u;
+	            check() << vec.front() == 7;
+            })
+
+        .add_case("compares_by_elements",
+            []
+            {
+	            Vec a{1, 2, 3};
+	            Vec b{1, 2, 3, 4, 5};
+	            b.resize(3);
+	            check() << (a == b) == true;
+	            b.push_back(0);
+	            check() << (a < b) == true;
+	            check() << (b < a) == false;
+            })
+
+        .add_case("inline_buffer_overlaps_heap_pointer",
+            []
+            {
+	            Vec vec{1, 2, 3, 4, 5};
+	            auto copy = vec;
+	            copy.push_back(6);
+
+	            check() << sizeof(Vec)
+	                == 2 * sizeof(std::size_t) + 4 * sizeof(int);
+	            check() << copy.isInline() == false;
+	            check() << vec.size() == 5u;
+	            check() << copy[5] == 6;
+            })
+
+        .add_case("moved_from_vector_is_empty",
+            []
+            {
+	            Vec a{1, 2, 3, 4, 5};
+	            Vec b(std::move(a));
+	            check() << b.size() == 5u;
+	            check() << a.empty() == true;
+	            a = b;
+	            check() << (a == b) == true;
+            });
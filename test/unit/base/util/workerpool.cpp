@@ -0,0 +1,64 @@
+#include "base/util/workerpool.h"
+
+#include <stdexcept>
+#include <vector>
+
+#include "../../util/test.h"
+
+using namespace test;
+
+static auto tests =
+    collection::add_suite("Util::WorkerPool")
+
+        .add_case("visits_every_index_once",
+            []
+            {
+	            Util::WorkerPool pool(4);
+	            std::vector<int> visits(10000, 0);
+	            for (auto round = 0; round < 3; round++)
+		            pool.forEach(visits.size(),
+		                64,
+		                [&](size_t begin, size_t end)
+		                {
+			                for (auto i = begin; i < end; i++)
+				                visits[i]++;
+		                });
+
+	            auto wrong = 0u;
+	            for (auto visit : visits)
+		            if (visit != 3) wrong++;
+	            check() << wrong == 0u;
+            })
+
+        .add_case("runs_on_caller_without_threads",
+            []
+            {
+	            Util::WorkerPool pool(1);
+	            size_t calls = 0;
+	            pool.forEach(100,
+	                10,
+	                [&](size_t begin, size_t end)
+	                {
+		                check() << begin == 0u;
+		                check() << end == 100u;
+		                calls++;
+	                });
+	            check() << pool.size() == 1u;
+	            check() << calls == 1u;
+            })
+
+        .add_case("rethrows_task_errors",
+            []
+            {
+	            Util::WorkerPool pool(3);
+	            throws<std::runtime_error>() << [&]
+	            {
+		            pool.forEach(1000,
+		                10,
+		                [](size_t begin, size_t)
+		                {
+			                if (begin == 500)
+				                throw std::runtime_error("failed");
+		                });
+	            };
+            });
@@ -0,0 +1,334 @@
+#include "chart/animator/keyframe.h"
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include "base/util/workerpool.h"
+
+#include "data/table/datatable.h"
+
+#include "../../util/allocations.h"
+#include "../../util/chart_data.h"
+#include "../../util/test.h"
+
+using namespace test;
+using namespace Vizzu;
+
+namespace
+{
+
+struct TestData : chart_data
+{
+	using chart_data::chart_data;
+
+	Gen::PlotPtr plot(std::initializer_list<const char *> colors,
+	    const char *x = "Country",
+	    const char *y = "Value",
+	    const char *label = nullptr)
+	{
+		auto res =
+		    options({{Gen::ChannelId::x, x}, {Gen::ChannelId::y, y}});
+		auto &channels = res->getChannels();
+		for (const auto *color : colors)
+			channels.addSeries(Gen::ChannelId::color,
+			    Data::SeriesIndex(color, table));
+		if (label)
+			channels.addSeries(Gen::ChannelId::label,
+			    Data::SeriesIndex(label, table));
+		return chart_data::plot(res);
+	}
+
+	static size_t actualMarkers(const Vizzu::Anim::Keyframe &keyframe)
+	{
+		return actual(keyframe).getMarkers().size();
+	}
+
+	static const Gen::Plot &actual(
+	    const Vizzu::Anim::Keyframe &keyframe)
+	{
+		return *std::static_pointer_cast<Gen::Plot>(keyframe.data());
+	}
+
+	static size_t enabledMarkers(const Gen::Plot &plot)
+	{
+		auto count = size_t{};
+		for (const auto &marker : plot.getMarkers())
+			if (marker.enabled == true) count++;
+		return count;
+	}
+
+	static bool samePositions(const Gen::Plot &a, const Gen::Plot &b)
+	{
+		const auto &aMarkers = a.getMarkers();
+		const auto &bMarkers = b.getMarkers();
+		if (aMarkers.size() != bMarkers.size()) return false;
+		for (auto i = 0u; i < aMarkers.size(); i++)
+			if (aMarkers[i].position != bMarkers[i].position
+			    || aMarkers[i].size != bMarkers[i].size)
+				return false;
+		return true;
+	}
+
+	static double maxDistance(const Gen::Plot &a, const Gen::Plot &b)
+	{
+		const auto &aMarkers = a.getMarkers();
+		const auto &bMarkers = b.getMarkers();
+		auto distance = 0.0;
+		for (auto i = 0u; i < aMarkers.size(); i++)
+			distance = std::max({distance,
+			    std::abs(aMarkers[i].position.x
+			             - bMarkers[i].position.x),
+			    std::abs(aMarkers[i].position.y
+			             - bMarkers[i].position.y),
+			    std::abs(aMarkers[i].size.y - bMarkers[i].size.y)});
+		return distance;
+	}
+};
+
+::Anim::Duration keyframeAt(const Vizzu::Anim::Keyframe &keyframe,
+    double factor)
+{
+	return keyframe.getDuration() * factor;
+}
+
+}
+
+static auto tests =
+    collection::add_suite("Anim::Keyframe")
+
+        .add_case("matches_markers_with_same_shared_categories",
+            []
+            {
+	            TestData data;
+	            Vizzu::Anim::Keyframe keyframe(data.plot({}),
+	                data.plot({"Region"}));
+	            auto count = TestData::actualMarkers(keyframe);
+	            // three matched markers and the three empty region cells
+	            check() << count == 6u;
+            })
+
+        .add_case("drill_down_morphs_into_first_matching_marker",
+            []
+            {
+	            TestData data;
+	            Vizzu::Anim::Keyframe keyframe(data.plot({}),
+	                data.plot({"Year"}));
+	            ::Anim::Controllable &control = keyframe;
+	            const auto &actual = TestData::actual(keyframe);
+
+	            auto count = TestData::actualMarkers(keyframe);
+	            control.setPosition(::Anim::Duration(0));
+	            auto atStart = TestData::enabledMarkers(actual);
+	            control.setPosition(keyframe.getDuration());
+	            auto atEnd = TestData::enabledMarkers(actual);
+
+	            // each country morphs into its first year, the second
+	            // years fade in
+	            check() << count == 6u;
+	            check() << atStart == 3u;
+	            check() << atEnd == 6u;
+            })
+
+        .add_case("roll_up_morphs_first_matching_marker",
+            []
+            {
+	            TestData data;
+	            Vizzu::Anim::Keyframe keyframe(data.plot({"Year"}),
+	                data.plot({}));
+	            ::Anim::Controllable &control = keyframe;
+	            const auto &actual = TestData::actual(keyframe);
+
+	            auto count = TestData::actualMarkers(keyframe);
+	            control.setPosition(keyframe.getDuration());
+	            auto atEnd = TestData::enabledMarkers(actual);
+
+	            check() << count == 6u;
+	            check() << atEnd == 3u;
+            })
+
+        .add_case("merged_plots_stay_aligned",
+            []
+            {
+	            TestData data;
+	            auto source = data.plot({"Region"});
+	            auto target = data.plot({});
+	            Vizzu::Anim::Keyframe keyframe(source, target);
+	            const auto &markers =
+	                std::as_const(*source).getMarkers();
+	            auto count = TestData::actualMarkers(keyframe);
+	            check() << count == markers.size();
+	            check() << count == 6u;
+            })
+
+        .add_case("single_pass_morph_reaches_both_ends",
+            []
+            {
+	            TestData data;
+	            Vizzu::Anim::Keyframe keyframe(data.plot({}),
+	                data.plot({}, "Value", "Country"));
+	            ::Anim::Controllable &control = keyframe;
+	            const auto &actual = TestData::actual(keyframe);
+
+	            control.setPosition(keyframe.getDuration());
+	            auto atEnd = TestData::samePositions(actual,
+	                *data.plot({}, "Value", "Country"));
+
+	            control.setPosition(::Anim::Duration(0));
+	            auto atStart =
+	                TestData::samePositions(actual, *data.plot({}));
+
+	            control.setPosition(keyframe.getDuration());
+	            control.setPosition(keyframe.getDuration());
+	            auto repeated = TestData::samePositions(actual,
+	                *data.plot({}, "Value", "Country"));
+
+	            check() << atEnd == true;
+	            check() << atStart == true;
+	            check() << repeated == true;
+            })
+
+        .add_case("replayed_marker_frames_do_not_allocate",
+            []
+            {
+	            TestData data(2000);
+	            Vizzu::Anim::Keyframe keyframe(
+	                data.plot({}, "Country", "Value", "Country"),
+	                data.plot({}, "Country", "Value", "Value"));
+	            ::Anim::Controllable &control = keyframe;
+	            auto frames = 60;
+	            for (auto frame = 0; frame <= frames; frame++)
+		            control.setPosition(
+		                keyframeAt(keyframe, frame / double(frames)));
+
+	            allocations allocs;
+	            for (auto frame = frames; frame >= 0; frame--)
+		            control.setPosition(
+		                keyframeAt(keyframe, frame / double(frames)));
+	            auto count = allocs.count();
+
+	            check() << count == 0u;
+            })
+
+        .add_case("parallel_evaluation_matches_serial",
+            []
+            {
+	            TestData data(5000);
+	            Vizzu::Anim::Keyframe serial(data.plot({}),
+	                data.plot({}, "Value", "Country"));
+	            Vizzu::Anim::Keyframe parallel(data.plot({}),
+	                data.plot({}, "Value", "Country"));
+	            parallel.setWorkerPool(
+	                std::make_shared<Util::WorkerPool>(4));
+
+	            auto equal = true;
+	            for (auto step = 0; step <= 10; step++) {
+		            auto position = keyframeAt(serial, step / 10.0);
+		            static_cast<::Anim::Controllable &>(serial)
+		                .setPosition(position);
+		            static_cast<::Anim::Controllable &>(parallel)
+		                .setPosition(position);
+		            equal = equal
+		                 && TestData::samePositions(
+		                     TestData::actual(serial),
+		                     TestData::actual(parallel));
+	            }
+	            auto count = TestData::actualMarkers(parallel);
+	            check() << equal == true;
+	            check() << count > 5000u;
+            })
+
+        .add_case("baked_seek_follows_live_evaluation",
+            []
+            {
+	            TestData data;
+	            Vizzu::Anim::Keyframe live(data.plot({}),
+	                data.plot({}, "Value", "Country"));
+	            Vizzu::Anim::Keyframe baked(data.plot({}),
+	                data.plot({}, "Value", "Country"));
+	            baked.setBakeCache(
+	                std::make_shared<Vizzu::Anim::BakeCache>(1 << 20));
+
+	            ::Anim::Controllable &control = baked;
+	            control.setPosition(baked.getDuration());
+	            auto bakedAfterPlay = baked.isBaked();
+	            control.setPosition(::Anim::Duration(0));
+	            auto bakedAfterRewind = baked.isBaked();
+
+	            auto distance = 0.0;
+	            for (auto step = 0; step <= 25; step++) {
+		            auto position = keyframeAt(live, step / 25.0);
+		            static_cast<::Anim::Controllable &>(live)
+		                .setPosition(position);
+		            control.setPosition(position);
+		            distance = std::max(distance,
+		                TestData::maxDistance(TestData::actual(live),
+		                    TestData::actual(baked)));
+	            }
+
+	            check() << bakedAfterPlay == false;
+	            check() << bakedAfterRewind == true;
+	            check() << distance < 0.01;
+            })
+
+        .add_case("setting_the_same_bake_cache_keeps_frames",
+            []
+            {
+	            TestData data;
+	            Vizzu::Anim::Keyframe keyframe(data.plot({}),
+	                data.plot({}, "Value", "Country"));
+	            auto cache =
+	                std::make_shared<Vizzu::Anim::BakeCache>(1 << 20);
+	            keyframe.setBakeCache(cache);
+	            keyframe.bake();
+	            auto bytes = cache->usedBytes();
+
+	            keyframe.setBakeCache(cache);
+
+	            check() << keyframe.isBaked() == true;
+	            check() << cache->usedBytes() == bytes;
+            })
+
+        .add_case("bake_cache_evicts_least_recently_seeked",
+            []
+            {
+	            TestData data;
+	            auto make = [&]
+	            {
+		            return std::make_unique<Vizzu::Anim::Keyframe>(
+		                data.plot({}),
+		                data.plot({}, "Value", "Country"));
+	            };
+
+	            auto probe = make();
+	            auto unlimited =
+	                std::make_shared<Vizzu::Anim::BakeCache>(1 << 20);
+	            probe->setBakeCache(unlimited);
+	            probe->bake();
+	            auto bytes = unlimited->usedBytes();
+
+	            auto cache = std::make_shared<Vizzu::Anim::BakeCache>(
+	                bytes * 2 + bytes / 2);
+	            auto first = make();
+	            auto second = make();
+	            auto third = make();
+	            first->setBakeCache(cache);
+	            second->setBakeCache(cache);
+	            third->setBakeCache(cache);
+
+	            first->bake();
+	            second->bake();
+	            static_cast<::Anim::Controllable &>(*first).setPosition(
+	                ::Anim::Duration(0));
+	            third->bake();
+
+	            check() << bytes > 0u;
+	            check() << first->isBaked() == true;
+	            check() << second->isBaked() == false;
+	            check() << third->isBaked() == true;
+	            check() << cache->usedBytes() == bytes * 2;
+
+	            second.reset();
+	            third.reset();
+	            check() << cache->usedBytes() == bytes;
+            });
@@ -0,0 +1,194 @@
+#include "chart/animator/plancache.h"
+
+#include "chart/animator/animation.h"
+#include "chart/generator/selector.h"
+#include "data/table/datatable.h"
+
+#include "../../util/chart_data.h"
+#include "../../util/test.h"
+
+using namespace test;
+using namespace Vizzu;
+
+namespace
+{
+
+struct TestData : chart_data
+{
+	Gen::PlotPtr plot(const char *x, const char *y)
+	{
+		return chart_data::plot(
+		    {{Gen::ChannelId::x, x}, {Gen::ChannelId::y, y}});
+	}
+
+	static Gen::PlotPtr copy(const Gen::PlotPtr &plot)
+	{
+		return std::make_shared<Gen::Plot>(*plot);
+	}
+};
+
+struct Player
+{
+	Vizzu::Anim::Animation animation;
+	Gen::PlotPtr shown;
+
+	Player(const Gen::PlotPtr &plot,
+	    const std::shared_ptr<Vizzu::Anim::PlanCache> &cache) :
+	    animation(plot)
+	{
+		animation.setPlanCache(cache);
+		animation.onPlotChanged.attach(
+		    [this](const Gen::PlotPtr &plot)
+		    {
+			    shown = plot;
+		    });
+	}
+
+	const Gen::Plot &at(double progress)
+	{
+		animation.seekProgress(progress);
+		return *shown;
+	}
+};
+
+bool samePositions(const Gen::Plot::Markers &aMarkers,
+    const Gen::Plot::Markers &bMarkers)
+{
+	if (aMarkers.size() != bMarkers.size()) return false;
+	for (auto i = 0u; i < aMarkers.size(); i++)
+		if (aMarkers[i].position != bMarkers[i].position
+		    || aMarkers[i].size != bMarkers[i].size)
+			return false;
+	return true;
+}
+
+bool samePositions(const Gen::Plot &a, const Gen::Plot &b)
+{
+	return samePositions(a.getMarkers(), b.getMarkers());
+}
+
+}
+
+static auto tests =
+    collection::add_suite("Anim::PlanCache")
+
+        .add_case("copies_of_a_plot_share_its_identity",
+            []
+            {
+	            TestData data;
+	            auto plot = data.plot("Country", "Value");
+	            auto other = data.plot("Country", "Value");
+
+	            auto copy = TestData::copy(plot);
+
+	            check() << copy->getId() == plot->getId();
+	            check() << (other->getId() != plot->getId()) == true;
+            })
+
+        .add_case("reversed_transition_replays_forward_plan",
+            []
+            {
+	            TestData data;
+	            auto columns = data.plot("Country", "Value");
+	            auto bars = data.plot("Value", "Country");
+	            auto cache = std::make_shared<Vizzu::Anim::PlanCache>();
+
+	            Player forward(columns, cache);
+	            forward.animation.addKeyframe(bars, {});
+	            auto atEnd = samePositions(forward.at(1.0),
+	                *data.plot("Value", "Country"));
+	            auto *forwardActual = forward.shown.get();
+
+	            Player backward(TestData::copy(bars), cache);
+	            backward.animation.addKeyframe(TestData::copy(columns),
+	                {});
+	            auto duration = backward.animation.getDuration();
+	            auto quarter = backward.at(0.25).getMarkers();
+	            auto mirrored = samePositions(quarter,
+	                forward.at(0.75).getMarkers());
+	            auto atStart = samePositions(backward.at(1.0),
+	                *data.plot("Country", "Value"));
+
+	            check() << atEnd == true;
+	            check() << cache->size() == 1u;
+	            check() << (backward.shown.get() != forwardActual)
+	                == true;
+	            check() << (duration == forward.animation.getDuration())
+	                == true;
+	            check() << mirrored == true;
+	            check() << atStart == true;
+            })
+
+        .add_case("replayed_plan_shares_no_state",
+            []
+            {
+	            TestData data;
+	            auto columns = data.plot("Country", "Value");
+	            auto bars = data.plot("Value", "Country");
+	            auto cache = std::make_shared<Vizzu::Anim::PlanCache>();
+
+	            Player first(columns, cache);
+	            first.animation.addKeyframe(bars, {});
+	            const auto &firstEnd = first.at(1.0);
+	            auto firstEndMarkers = firstEnd.getMarkers();
+
+	            Player second(TestData::copy(columns), cache);
+	            second.animation.addKeyframe(TestData::copy(bars), {});
+	            const auto &secondMiddle = second.at(0.5);
+
+	            check() << cache->size() == 1u;
+	            check() << (&secondMiddle != &firstEnd) == true;
+	            check() << samePositions(first.shown->getMarkers(),
+	                firstEndMarkers)
+	                == true;
+            })
+
+        .add_case("plot_changed_in_place_is_planned_again",
+            []
+            {
+	            TestData data;
+	            auto columns = data.plot("Country", "Value");
+	            auto bars = data.plot("Value", "Country");
+	            auto cache = std::make_shared<Vizzu::Anim::PlanCache>();
+
+	            Player there(columns, cache);
+	            there.animation.addKeyframe(bars, {});
+	            const auto &marker =
+	                std::as_const(*columns).getMarkers()[0];
+	            Gen::Selector(*columns).toggleMarker(marker);
+
+	            Player back(bars, cache);
+	            back.animation.addKeyframe(columns, {});
+	            auto selected =
+	                back.at(1.0).getMarkers()[0].selected == true;
+
+	            check() << cache->size() == 2u;
+	            check() << selected == true;
+            })
+
+        .add_case("different_options_are_planned_separately",
+            []
+            {
+	            TestData data;
+	            auto columns = data.plot("Country", "Value");
+	            auto bars = data.plot("Value", "Country");
+	            auto cache = std::make_shared<Vizzu::Anim::PlanCache>();
+
+	            Player first(columns, cache);
+	            first.animation.addKeyframe(bars, {});
+
+	            Vizzu::Anim::Options options;
+	            options.set("duration", "2s");
+	            Player second(TestData::copy(columns), cache);
+	            second.animation.addKeyframe(TestData::copy(bars),
+	                options.keyframe);
+
+	            Player third(TestData::copy(columns), cache);
+	            third.animation.addKeyframe(TestData::copy(bars),
+	                options.keyframe);
+
+	            check() << cache->size() == 2u;
+	            check() << (second.animation.getDuration()
+	                        == third.animation.getDuration())
+	                == true;
+            });
@@ -0,0 +1,101 @@
+#include "chart/animator/styles.h"
+
+#include "../../util/test.h"
+
+using namespace test;
+using namespace Vizzu;
+
+namespace
+{
+
+struct Timeline : ::Anim::Group
+{
+	using ::Anim::Group::setPosition;
+
+	void at(double factor) { setPosition(getDuration() * factor); }
+};
+
+struct Styles3
+{
+	Styles::Chart source = Styles::Chart::def();
+	Styles::Chart target = Styles::Chart::def();
+	Styles::Chart actual = Styles::Chart::def();
+
+	Styles3()
+	{
+		target.borderWidth = *source.borderWidth + 2.0;
+		target.backgroundColor = Gfx::Color(1.0, 0.0, 0.0, 1.0);
+		target.fontSize = Gfx::Length::Absolute(30.0);
+		target.fontStyle = Gfx::Font::Style::italic;
+	}
+};
+
+}
+
+static auto tests =
+    collection::add_suite("Anim::Morph::StyleMorphFactory")
+
+        .add_case("equal_styles_need_no_morph",
+            []
+            {
+	            auto source = Styles::Chart::def();
+	            auto target = Styles::Chart::def();
+	            auto actual = Styles::Chart::def();
+	            Vizzu::Anim::Morph::StyleMorphFactory factory(source,
+	                target,
+	                actual);
+	            check() << factory.isNeeded() == false;
+            })
+
+        .add_case("differing_params_are_compiled_into_one_element",
+            []
+            {
+	            Styles3 styles;
+	            Vizzu::Anim::Morph::StyleMorphFactory factory(
+	                styles.source,
+	                styles.target,
+	                styles.actual);
+	            Timeline timeline;
+	            factory.populate(timeline,
+	                ::Anim::Options(::Anim::Duration::Sec(1),
+	                    ::Anim::Duration(0),
+	                    ::Anim::Easing(&::Anim::Easing::linear)));
+
+	            timeline.at(0.5);
+	            auto midWidth = *styles.actual.borderWidth;
+	            auto midRed = styles.actual.backgroundColor->red;
+	            auto midStyle = *styles.actual.fontStyle;
+
+	            timeline.at(1.0);
+
+	            check() << factory.isNeeded() == false;
+	            check() << midWidth
+	                == *styles.source.borderWidth + 1.0;
+	            check() << midRed
+	                == (styles.source.backgroundColor->red + 1.0) / 2;
+	            check() << (midStyle == Gfx::Font::Style::italic)
+	                == true;
+	            check() << styles.actual.fontSize->absolute == 30.0;
+	            check() << (*styles.actual.backgroundColor
+	                        == *styles.target.backgroundColor)
+	                == true;
+            })
+
+        .add_case("morph_takes_new_revision_when_factor_changes",
+            []
+            {
+	            Styles3 styles;
+	            Styles::Revision revision;
+	            Vizzu::Anim::Morph::StyleMorph morph(styles.source,
+	                styles.target,
+	                styles.actual,
+	                &revision);
+	            auto initial = revision;
+
+	            morph.transform(0.5);
+	            auto moved = revision;
+	            morph.transform(0.5);
+
+	            check() << (moved == initial) == false;
+	            check() << (revision == moved) == true;
+            });
@@ -0,0 +1,28 @@
+#include "chart/options/options.h"
+
+#include <cstddef>
+#include <cstring>
+#include <memory>
+#include <new>
+
+#include "../../util/test.h"
+
+using namespace test;
+using namespace Vizzu;
+
+static auto tests =
+    collection::add_suite("Gen::Options")
+
+        .add_case("default_options_are_not_rotated",
+            []
+            {
+	            alignas(Gen::Options) std::byte
+	                storage[sizeof(Gen::Options)];
+	            std::memset(storage, 0xff, sizeof(storage));
+
+	            auto *options = new (storage) Gen::Options;
+	            auto angle = options->angle;
+	            std::destroy_at(options);
+
+	            check() << angle == 0.0;
+            });
@@ -0,0 +1,87 @@
+#include "chart/rendering/painter/coordinatesystem.h"
+
+#include <cmath>
+#include <vector>
+
+#include "../../util/test.h"
+
+using namespace test;
+using namespace Vizzu;
+
+namespace
+{
+
+std::vector<Geom::Point> grid()
+{
+	std::vector<Geom::Point> res;
+	for (auto x = -0.25; x <= 1.25; x += 0.125)
+		for (auto y = -0.25; y <= 1.25; y += 0.125)
+			res.emplace_back(x, y);
+	return res;
+}
+
+bool matchesScalar(const Draw::CoordinateSystem &coordSys)
+{
+	auto points = grid();
+	std::vector<Geom::Point> converted(points.size());
+	coordSys.convert(points, converted);
+
+	for (auto i = 0u; i < points.size(); i++) {
+		auto expected = coordSys.convert(points[i]);
+		if ((converted[i] - expected).chebyshev() > 1e-9) return false;
+	}
+	return true;
+}
+
+}
+
+static auto tests =
+    collection::add_suite("Draw::CoordinateSystem")
+
+        .add_case("batch_conversion_matches_scalar",
+            []
+            {
+	            for (auto polar : {0.0, 0.3, 0.5, 1.0})
+		            for (auto angle : {0.0, M_PI / 2.0, 1.0})
+			            for (auto keepAspectRatio : {0.0, 0.7}) {
+				            Draw::CoordinateSystem coordSys(
+				                Geom::Rect(10, 20, 400, 300),
+				                angle,
+				                Math::FuzzyBool(polar),
+				                Math::FuzzyBool(keepAspectRatio));
+				            check() << matchesScalar(coordSys) == true;
+			            }
+            })
+
+        .add_case("batch_conversion_works_in_place",
+            []
+            {
+	            Draw::CoordinateSystem coordSys(
+	                Geom::Rect(0, 0, 200, 100),
+	                0.5,
+	                Math::FuzzyBool(0.6),
+	                Math::FuzzyBool(false));
+	            auto points = grid();
+	            auto expected = points;
+	            coordSys.convert(points, expected);
+	            coordSys.convert(points, points);
+
+	            check() << (points == expected) == true;
+            })
+
+        .add_case("batch_conversion_needs_equal_sizes",
+            []
+            {
+	            Draw::CoordinateSystem coordSys(
+	                Geom::Rect(0, 0, 200, 100),
+	                0.0,
+	                Math::FuzzyBool(false),
+	                Math::FuzzyBool(false));
+	            std::vector<Geom::Point> points(3);
+	            std::vector<Geom::Point> res(2);
+
+	            throws<std::logic_error>() << [&]
+	            {
+		            coordSys.convert(points, res);
+	            };
+            });
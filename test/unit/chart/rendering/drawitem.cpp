@@ -0,0 +1,77 @@
+#include "chart/rendering/drawitem.h"
+
+#include "../../util/test.h"
+
+using namespace test;
+using namespace Vizzu;
+
+using Culling = Draw::drawItem::Culling;
+
+namespace
+{
+
+const auto opaque =
+    std::make_pair(Gfx::Color(0, 0, 0), Gfx::Color(1, 0, 0));
+const auto viewport = Geom::Rect(0, 0, 100, 100);
+
+}
+
+static auto tests =
+    collection::add_suite("Draw::drawItem")
+
+        .add_case("transparent_marker_is_skipped",
+            []
+            {
+	            auto transparent =
+	                std::make_pair(Gfx::Color(0, 0, 0, 0),
+	                    Gfx::Color(1, 0, 0, 0));
+	            check() << (Draw::drawItem::cull(transparent,
+	                            Geom::Rect(10, 10, 20, 20),
+	                            1.0,
+	                            viewport)
+	                        == Culling::skip)
+	                == true;
+            })
+
+        .add_case("marker_off_the_viewport_is_skipped",
+            []
+            {
+	            auto outside = Draw::drawItem::cull(opaque,
+	                Geom::Rect(110, 10, 20, 20),
+	                5.0,
+	                viewport);
+	            auto borderInside = Draw::drawItem::cull(opaque,
+	                Geom::Rect(103, 10, 20, 20),
+	                5.0,
+	                viewport);
+
+	            check() << (outside == Culling::skip) == true;
+	            check() << (borderInside == Culling::shape) == true;
+            })
+
+        .add_case("sub_pixel_marker_is_a_pixel_despite_its_border",
+            []
+            {
+	            auto tiny = Draw::drawItem::cull(opaque,
+	                Geom::Rect(10, 10, 0.5, 0.5),
+	                2.0,
+	                viewport);
+	            auto wide = Draw::drawItem::cull(opaque,
+	                Geom::Rect(10, 10, 2, 0.5),
+	                2.0,
+	                viewport);
+
+	            check() << (tiny == Culling::pixel) == true;
+	            check() << (wide == Culling::shape) == true;
+            })
+
+        .add_case("marker_without_bounds_is_drawn_as_shape",
+            []
+            {
+	            // e.g. polar markers, whose corners do not bound them
+	            auto polar = Draw::drawItem::cull(opaque,
+	                std::nullopt,
+	                1.0,
+	                viewport);
+	            check() << (polar == Culling::shape) == true;
+            });
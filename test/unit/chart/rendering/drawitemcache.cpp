@@ -0,0 +1,110 @@
+#include "chart/rendering/items/drawitemcache.h"
+
+#include "chart/generator/selector.h"
+#include "data/table/datatable.h"
+
+#include "../../util/chart_data.h"
+#include "../../util/test.h"
+
+using namespace test;
+using namespace Vizzu;
+
+namespace
+{
+
+struct TestPlot : chart_data
+{
+	Gen::PlotPtr plot{
+	    chart_data::plot({{Gen::ChannelId::x, "Year"},
+	        {Gen::ChannelId::y, "Value"},
+	        {Gen::ChannelId::color, "Country"}})};
+
+	const Gen::Plot &get() const { return std::as_const(*plot); }
+};
+
+}
+
+static auto tests =
+    collection::add_suite("Draw::DrawItemCache")
+
+        .add_case("items_are_computed_once_per_marker",
+            []
+            {
+	            TestPlot data;
+	            const auto &plot = data.get();
+	            const auto &marker = plot.getMarkers()[1];
+	            Draw::DrawItemCache cache;
+	            cache.update(plot, Geom::Rect(0, 0, 400, 300));
+
+	            const auto *first = &cache.get(marker, 0);
+	            cache.update(plot, Geom::Rect(0, 0, 400, 300));
+	            const auto *second = &cache.get(marker, 0);
+
+	            auto expected = Draw::DrawItem::createInterpolated(marker,
+	                *plot.getOptions(),
+	                plot.getStyle(),
+	                cache.getCoordSys(),
+	                plot.getMarkers(),
+	                0);
+
+	            check() << (first == second) == true;
+	            check() << (first->points == expected.points) == true;
+	            check() << (first->center == expected.center) == true;
+            })
+
+        .add_case("area_change_rebuilds_coordinate_system",
+            []
+            {
+	            TestPlot data;
+	            const auto &plot = data.get();
+	            const auto &marker = plot.getMarkers()[0];
+	            Draw::DrawItemCache cache;
+
+	            cache.update(plot, Geom::Rect(0, 0, 400, 300));
+	            auto before = cache.get(marker, 0).points;
+	            auto sameArea = cache.getCoordSys().getRect();
+	            cache.update(plot, Geom::Rect(0, 0, 800, 600));
+	            auto after = cache.get(marker, 0).points;
+
+	            check() << (before == after) == true;
+	            check() << (sameArea == Geom::Rect(0, 0, 400, 300))
+	                == true;
+	            check() << (cache.getCoordSys().getRect()
+	                        == Geom::Rect(0, 0, 800, 600))
+	                == true;
+            })
+
+        .add_case("selection_rebuilds_items_on_the_new_markers",
+            []
+            {
+	            TestPlot data;
+	            const auto &plot = data.get();
+	            Draw::DrawItemCache cache;
+	            cache.update(plot, Geom::Rect(0, 0, 400, 300));
+	            cache.get(plot.getMarkers()[0], 0);
+
+	            // a handle kept elsewhere makes the selection copy the
+	            // markers
+	            auto kept = plot.shareMarkers();
+	            Gen::Selector(*data.plot).toggleMarker(
+	                plot.getMarkers()[0]);
+	            cache.update(plot, Geom::Rect(0, 0, 400, 300));
+	            const auto &marker = plot.getMarkers()[0];
+	            const auto &item = cache.get(marker, 0);
+
+	            check() << kept.sharesWith(plot.shareMarkers())
+	                == false;
+	            check() << (&item.marker == &marker) == true;
+	            check() << item.marker.selected == true;
+            })
+
+        .add_case("get_without_plot_throws",
+            []
+            {
+	            TestPlot data;
+	            Draw::DrawItemCache cache;
+	            throws<std::logic_error>() << [&]
+	            {
+		            cache.get(data.get().getMarkers()[0], 0);
+	            };
+            });
@@ -0,0 +1,271 @@
+#include "chart/rendering/layercache.h"
+
+#include <array>
+
+#include "base/gfx/displaylistcanvas.h"
+#include "chart/generator/selector.h"
+#include "data/table/datatable.h"
+
+#include "../../util/chart_data.h"
+#include "../../util/test.h"
+
+using namespace test;
+using namespace Vizzu;
+
+namespace
+{
+
+struct TestPlot : chart_data
+{
+	Gen::PlotPtr plot{chart_data::plot(
+	    {{Gen::ChannelId::x, "Year"}, {Gen::ChannelId::y, "Value"}})};
+	Layout layout;
+	Draw::Quality quality;
+	Events::Draw events;
+
+	TestPlot() { layout.boundary = Geom::Rect(0, 0, 400, 300); }
+
+	Draw::LayerState state(bool animating = false)
+	{
+		return {*plot, layout, quality, events, animating};
+	}
+};
+
+/** Counts the replayed display lists and the queries whether it can
+ *  replay; replays and keeps the previous frame if asked to. */
+class TestCanvas : public Gfx::DisplayListCanvas
+{
+public:
+	bool replays;
+	bool keepsFrame{};
+	size_t replayed{};
+	mutable size_t queried{};
+	std::optional<Geom::Rect> repainted;
+
+	explicit TestCanvas(bool replays) : replays(replays) {}
+
+	void *getPainter() override { return nullptr; }
+
+	bool canReplay() const override
+	{
+		queried++;
+		return replays;
+	}
+
+	bool replay(const Gfx::DisplayList &) override
+	{
+		if (replays) replayed++;
+		return replays;
+	}
+
+	bool repaintArea(const Geom::Rect &area) override
+	{
+		if (keepsFrame) repainted = area;
+		return keepsFrame;
+	}
+};
+
+Draw::LayerCache::DrawLayer rectangle(const Geom::Rect &rect,
+    size_t &drawn)
+{
+	return [&drawn, rect](Gfx::ICanvas &canvas)
+	{
+		drawn++;
+		canvas.rectangle(rect);
+	};
+}
+
+}
+
+static auto tests =
+    collection::add_suite("Draw::LayerCache")
+
+        .add_case("same_state_changes_no_layer",
+            []
+            {
+	            TestPlot data;
+	            auto changed =
+	                data.state().changedSince(data.state());
+
+	            check() << (changed == std::array<bool, 4>{}) == true;
+            })
+
+        .add_case("selection_keeps_background_only",
+            []
+            {
+	            TestPlot data;
+	            auto prev = data.state();
+	            const auto &marker =
+	                std::as_const(*data.plot).getMarkers()[0];
+	            Gen::Selector(*data.plot).toggleMarker(marker);
+
+	            auto changed = data.state().changedSince(prev);
+
+	            check() << (changed
+	                        == std::array<bool, 4>{false,
+	                            true,
+	                            true,
+	                            true})
+	                == true;
+            })
+
+        .add_case("markers_are_not_cached_while_animating",
+            []
+            {
+	            TestPlot data;
+	            auto state = data.state(true);
+
+	            check() << state.cacheable(Draw::Layer::background)
+	                == true;
+	            check() << state.cacheable(Draw::Layer::markers) == false;
+            })
+
+        .add_case("unchanged_layer_is_replayed",
+            []
+            {
+	            TestPlot data;
+	            TestCanvas canvas(true);
+	            Draw::LayerCache cache;
+	            auto drawn = 0u;
+	            auto drawLayer = [&](Gfx::ICanvas &layerCanvas)
+	            {
+		            drawn++;
+		            layerCanvas.rectangle(Geom::Rect(0, 0, 1, 1));
+	            };
+
+	            cache.update(data.state());
+	            cache.draw(canvas, Draw::Layer::background, drawLayer);
+	            cache.update(data.state());
+	            cache.draw(canvas, Draw::Layer::background, drawLayer);
+
+	            check() << drawn == 1u;
+	            check() << canvas.replayed == 2u;
+	            check() << canvas.getDisplayList().empty() == true;
+            })
+
+        .add_case("canvas_without_replay_gets_every_layer_drawn",
+            []
+            {
+	            TestPlot data;
+	            TestCanvas canvas(false);
+	            Draw::LayerCache cache;
+	            auto drawn = 0u;
+	            auto drawLayer = [&](Gfx::ICanvas &)
+	            {
+		            drawn++;
+	            };
+
+	            cache.update(data.state());
+	            cache.draw(canvas, Draw::Layer::background, drawLayer);
+	            cache.update(data.state());
+	            cache.draw(canvas, Draw::Layer::background, drawLayer);
+
+	            check() << drawn == 2u;
+	            check() << cache.isCached(Draw::Layer::background)
+	                == false;
+            })
+
+        .add_case("unchanged_frame_repaints_nothing",
+            []
+            {
+	            TestPlot data;
+	            TestCanvas canvas(true);
+	            canvas.keepsFrame = true;
+	            Draw::LayerCache cache;
+	            auto drawn = size_t{};
+	            auto layer = rectangle(Geom::Rect(0, 0, 10, 10), drawn);
+
+	            cache.update(data.state());
+	            cache.draw(canvas, {layer, layer, layer, layer});
+	            auto first = cache.getDamage();
+	            cache.update(data.state());
+	            cache.draw(canvas, {layer, layer, layer, layer});
+
+	            check() << first.has_value() == false;
+	            check() << drawn == 4u;
+	            check() << canvas.repainted.has_value() == true;
+	            check() << canvas.repainted->size.area() == 0.0;
+	            check() << canvas.replayed == 4u;
+            })
+
+        .add_case("changed_layer_repaints_its_old_and_new_area",
+            []
+            {
+	            TestPlot data;
+	            TestCanvas canvas(true);
+	            canvas.keepsFrame = true;
+	            Draw::LayerCache cache;
+	            auto drawn = size_t{};
+	            auto base = rectangle(Geom::Rect(0, 0, 100, 100), drawn);
+	            auto before = rectangle(Geom::Rect(10, 10, 5, 5), drawn);
+	            auto after = rectangle(Geom::Rect(30, 10, 5, 5), drawn);
+	            auto empty = [](Gfx::ICanvas &) {};
+
+	            cache.update(data.state());
+	            cache.draw(canvas, {base, empty, empty, before});
+	            const auto &marker =
+	                std::as_const(*data.plot).getMarkers()[0];
+	            Gen::Selector(*data.plot).toggleMarker(marker);
+	            cache.update(data.state());
+	            cache.draw(canvas, {base, empty, empty, after});
+
+	            auto damage = cache.getDamage();
+	            check() << damage.has_value() == true;
+	            check() << damage->contains(Geom::Point(12, 12)) == true;
+	            check() << damage->contains(Geom::Point(32, 12)) == true;
+	            check() << damage->contains(Geom::Point(80, 80)) == false;
+            })
+
+        .add_case("lost_frame_is_drawn_whole",
+            []
+            {
+	            TestPlot data;
+	            TestCanvas canvas(true);
+	            Draw::LayerCache cache;
+	            auto drawn = size_t{};
+	            auto layer = rectangle(Geom::Rect(0, 0, 10, 10), drawn);
+
+	            cache.update(data.state());
+	            cache.draw(canvas, {layer, layer, layer, layer});
+	            cache.update(data.state());
+	            cache.draw(canvas, {layer, layer, layer, layer});
+
+	            check() << cache.getDamage().has_value() == false;
+	            check() << drawn == 4u;
+	            check() << canvas.replayed == 8u;
+            })
+
+        .add_case("new_style_revision_changes_every_layer",
+            []
+            {
+	            TestPlot data;
+	            auto prev = data.state();
+	            data.plot->getStyleRevision().bump();
+
+	            auto changed = data.state().changedSince(prev);
+
+	            check() << (changed
+	                        == std::array<bool, 4>{true,
+	                            true,
+	                            true,
+	                            true})
+	                == true;
+            })
+
+        .add_case("replay_support_is_queried_without_replaying",
+            []
+            {
+	            TestPlot data;
+	            TestCanvas canvas(true);
+	            Draw::LayerCache cache;
+	            auto drawn = size_t{};
+
+	            cache.update(data.state());
+	            cache.draw(canvas,
+	                Draw::Layer::background,
+	                rectangle(Geom::Rect(0, 0, 10, 10), drawn));
+
+	            check() << drawn == 1u;
+	            check() << canvas.queried == 1u;
+	            check() << canvas.replayed == 1u;
+            });
@@ -0,0 +1,143 @@
+#include "chart/rendering/items/markerbatches.h"
+
+#include <string>
+#include <vector>
+
+#include "../../util/test.h"
+
+using namespace test;
+using namespace Vizzu;
+
+namespace
+{
+
+/** Records the path and state commands as strings. */
+class RecordingCanvas : public Gfx::ICanvas, public Draw::Painter
+{
+public:
+	std::vector<std::string> commands;
+
+	Geom::Size textBoundary(const std::string &) override
+	{
+		return {};
+	}
+	Geom::Rect getClipRect() const override { return {}; }
+	void setClipRect(const Geom::Rect &) override {}
+	void setClipCircle(const Geom::Circle &) override {}
+	void setClipPolygon() override {}
+	void setBrushColor(const Gfx::Color &color) override
+	{
+		commands.push_back("brush " + std::to_string(color.red));
+	}
+	void setLineColor(const Gfx::Color &) override {}
+	void setTextColor(const Gfx::Color &) override {}
+	void setLineWidth(double) override {}
+	void setFont(const Gfx::Font &) override {}
+	void transform(const Geom::AffineTransform &) override {}
+	void save() override {}
+	void restore() override {}
+	void beginDropShadow() override {}
+	void setDropShadowBlur(uint64_t) override {}
+	void setDropShadowColor(const Gfx::Color &) override {}
+	void setDropShadowOffset(const Geom::Point &) override {}
+	void endDropShadow() override {}
+	void beginPolygon() override { commands.emplace_back("begin"); }
+	void addPoint(const Geom::Point &) override {}
+	void addBezier(const Geom::Point &,
+	    const Geom::Point &,
+	    const Geom::Point &) override
+	{}
+	void closeSubpath() override { commands.emplace_back("close"); }
+	void endPolygon() override { commands.emplace_back("end"); }
+	void rectangle(const Geom::Rect &) override {}
+	void circle(const Geom::Circle &) override {}
+	void line(const Geom::Line &) override {}
+	void text(const Geom::Rect &, const std::string &) override {}
+	void setBrushGradient(const Geom::Line &,
+	    const Gfx::ColorGradient &) override
+	{}
+	void frameBegin() override {}
+	void frameEnd() override {}
+	void *getPainter() override
+	{
+		return static_cast<Draw::Painter *>(this);
+	}
+	Gfx::ICanvas &getCanvas() override { return *this; }
+};
+
+Draw::MarkerBatches::Style style(double red)
+{
+	return {Gfx::Color(), Gfx::Color(red, 0, 0), 1.0};
+}
+
+}
+
+static auto tests =
+    collection::add_suite("Draw::MarkerBatches")
+
+        .add_case("same_styled_shapes_share_one_path",
+            []
+            {
+	            Draw::MarkerBatches batches;
+	            batches.add(style(1), Geom::Rect(0, 0, 1, 1));
+	            batches.add(style(0), Geom::Rect(2, 0, 1, 1));
+	            batches.add(style(1), Geom::Rect(4, 0, 1, 1));
+
+	            RecordingCanvas canvas;
+	            batches.draw(canvas);
+
+	            check() << batches.groupCount() == 2u;
+	            check() << (canvas.commands
+	                        == std::vector<std::string>{"brush 1.000000",
+	                            "begin",
+	                            "close",
+	                            "close",
+	                            "end",
+	                            "brush 0.000000",
+	                            "begin",
+	                            "close",
+	                            "end"})
+	                == true;
+            })
+
+        .add_case("overlapping_shape_keeps_its_drawing_order",
+            []
+            {
+	            Draw::MarkerBatches batches;
+	            batches.add(style(1), Geom::Rect(0, 0, 2, 2));
+	            batches.add(style(0), Geom::Rect(1, 1, 2, 2));
+	            batches.add(style(1), Geom::Rect(2, 2, 2, 2));
+	            batches.add(style(1), Geom::Rect(6, 6, 1, 1));
+
+	            RecordingCanvas canvas;
+	            batches.draw(canvas);
+
+	            check() << batches.groupCount() == 3u;
+	            check() << (canvas.commands
+	                        == std::vector<std::string>{"brush 1.000000",
+	                            "begin",
+	                            "close",
+	                            "end",
+	                            "brush 0.000000",
+	                            "begin",
+	                            "close",
+	                            "end",
+	                            "brush 1.000000",
+	                            "begin",
+	                            "close",
+	                            "close",
+	                            "end"})
+	                == true;
+            })
+
+        .add_case("line_width_separates_groups",
+            []
+            {
+	            Draw::MarkerBatches batches;
+	            auto thin = style(1);
+	            thin.width = 0;
+	            batches.add(style(1), Geom::Rect(0, 0, 1, 1));
+	            batches.add(thin, Geom::Rect(0, 0, 1, 1));
+
+	            check() << batches.groupCount() == 2u;
+            });
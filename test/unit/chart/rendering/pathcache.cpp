@@ -0,0 +1,91 @@
+#include "chart/rendering/painter/pathcache.h"
+
+#include "../../util/test.h"
+
+using namespace test;
+using namespace Vizzu;
+
+namespace
+{
+
+Draw::CoordinateSystem coordSys(const Geom::Rect &rect,
+    bool polar = false)
+{
+	return Draw::CoordinateSystem(rect,
+	    0.0,
+	    Math::FuzzyBool(polar),
+	    Math::FuzzyBool(false));
+}
+
+Draw::PathCache::Key key(double x)
+{
+	return {{Geom::Point(x, 0),
+	            Geom::Point(x, 1),
+	            Geom::Point(x + 1, 1),
+	            Geom::Point(x + 1, 0)},
+	    0.0,
+	    0.0};
+}
+
+}
+
+static auto tests =
+    collection::add_suite("Draw::PathCache")
+
+        .add_case("outline_is_recorded_on_the_second_request",
+            []
+            {
+	            Draw::PathCache cache;
+	            auto system = coordSys(Geom::Rect(0, 0, 100, 100));
+
+	            auto *first = cache.find(1, key(0), system);
+	            auto recordFirst = cache.shouldRecord(1);
+	            auto *second = cache.find(1, key(0), system);
+	            auto recordSecond = cache.shouldRecord(1);
+	            cache.insert(1, system, {Geom::Point(50, 50)});
+	            auto *third = cache.find(1, key(0), system);
+
+	            check() << (first == nullptr) == true;
+	            check() << recordFirst == false;
+	            check() << (second == nullptr) == true;
+	            check() << recordSecond == true;
+	            check() << (third != nullptr) == true;
+	            check() << (third->front() == Geom::Point(0.5, 0.5))
+	                == true;
+            })
+
+        .add_case("changing_shapes_are_not_recorded",
+            []
+            {
+	            Draw::PathCache cache;
+	            auto system = coordSys(Geom::Rect(0, 0, 100, 100));
+
+	            cache.find(1, key(0), system);
+	            cache.find(1, key(1), system);
+
+	            check() << cache.shouldRecord(1) == false;
+            })
+
+        .add_case("outline_is_reused_when_the_area_only_scales",
+            []
+            {
+	            Draw::PathCache cache;
+	            auto system = coordSys(Geom::Rect(0, 0, 100, 50));
+	            cache.find(1, key(0), system);
+	            cache.find(1, key(0), system);
+	            cache.insert(1, system, {Geom::Point(50, 25)});
+
+	            auto scaled = coordSys(Geom::Rect(10, 10, 150, 75));
+	            auto stretched = coordSys(Geom::Rect(0, 0, 100, 100));
+	            auto polar = coordSys(Geom::Rect(0, 0, 100, 50), true);
+
+	            const auto *hit = cache.find(1, key(0), scaled);
+	            auto point = Draw::PathCache::fromRelative(scaled,
+	                hit->front());
+
+	            check() << (point == Geom::Point(85, 47.5)) == true;
+	            check() << (cache.find(1, key(0), stretched) == nullptr)
+	                == true;
+	            check() << (cache.find(1, key(0), polar) == nullptr)
+	                == true;
+            });
@@ -0,0 +1,92 @@
+#include "chart/rendering/quality.h"
+
+#include "../../util/test.h"
+
+using namespace test;
+using namespace Vizzu::Draw;
+
+namespace
+{
+
+const QualityController::Duration budget(0.010);
+const QualityController::Duration slow(0.020);
+const QualityController::Duration fast(0.002);
+
+void frame(QualityController &controller,
+    bool animating,
+    QualityController::Duration time)
+{
+	controller.beginFrame(animating);
+	controller.endFrame(time);
+}
+
+}
+
+static auto tests =
+    collection::add_suite("Draw::QualityController")
+
+        .add_case("slow_animation_frames_step_quality_down",
+            []
+            {
+	            QualityController controller(budget);
+	            frame(controller, true, slow);
+	            auto first = controller.get();
+	            for (auto i = 0; i < 10; i++)
+		            frame(controller, true, slow);
+	            auto last = controller.get();
+
+	            check() << (first.resolution == ResolutionMode::Low)
+	                == true;
+	            check() << first.dropShadows == true;
+	            check() << controller.getLevel()
+	                == QualityController::levels - 1;
+	            check() << last.dropShadows == false;
+	            check() << last.interlacingLabels == false;
+	            check() << last.markerLabels == false;
+            })
+
+        .add_case("frames_at_rest_get_full_quality",
+            []
+            {
+	            QualityController controller(budget);
+	            for (auto i = 0; i < 3; i++)
+		            frame(controller, true, slow);
+	            const auto &quality = controller.beginFrame(false);
+
+	            check() << controller.getLevel() == 0u;
+	            check() << (quality.resolution == ResolutionMode::High)
+	                == true;
+	            check() << quality.markerLabels == true;
+
+	            controller.endFrame(slow);
+	            check() << controller.getLevel() == 0u;
+            })
+
+        .add_case("quality_recovers_after_fast_frames",
+            []
+            {
+	            QualityController controller(budget);
+	            frame(controller, true, slow);
+	            frame(controller, true, slow);
+	            for (auto i = 1u; i < QualityController::recoveryFrames;
+	                 i++)
+		            frame(controller, true, fast);
+	            auto before = controller.getLevel();
+	            frame(controller, true, fast);
+
+	            check() << before == 2u;
+	            check() << controller.getLevel() == 1u;
+            })
+
+        .add_case("marker_batching_is_kept_on_every_level",
+            []
+            {
+	            QualityController controller(budget);
+	            controller.setMarkerBatching(true);
+	            auto atRest = controller.beginFrame(false);
+	            frame(controller, true, slow);
+
+	            check() << atRest.markerBatching == true;
+	            check() << controller.get().markerBatching == true;
+	            check() << Quality().markerBatching == false;
+            });
@@ -0,0 +1,115 @@
+#include "data/datacube/datacube.h"
+
+#include <array>
+
+#include "data/table/datatable.h"
+
+#include "../../util/allocations.h"
+#include "../../util/test.h"
+
+using namespace test;
+using namespace Vizzu::Data;
+
+namespace
+{
+
+struct TestCube
+{
+	DataTable table;
+	SeriesIndex dim0;
+	SeriesIndex dim1;
+	SeriesIndex measure;
+	DataCube cube;
+
+	TestCube()
+	{
+		std::array<const char *, 6> cat0{"a", "a", "b", "b", "c", "c"};
+		std::array<const char *, 6> cat1{"x", "y", "x", "y", "x", "y"};
+		std::array<double, 6> values{1, 2, 3, 4, 5, 6};
+		dim0 = SeriesIndex(
+		    table.addColumn("Dim0", std::span<const char *>(cat0)));
+		dim1 = SeriesIndex(
+		    table.addColumn("Dim1", std::span<const char *>(cat1)));
+		measure = SeriesIndex(
+		    table.addColumn("Meas", std::span<double>(values)));
+		cube = DataCube(table,
+		    DataCubeOptions({dim0, dim1}, {measure}));
+	}
+};
+
+}
+
+static auto tests =
+    collection::add_suite("Data::DataCube")
+
+        .add_case("aggregates_over_inverse_sub_slice",
+            []
+            {
+	            TestCube test;
+	            SeriesList sumBy;
+	            sumBy.pushBack(test.dim1);
+
+	            auto sum = static_cast<double>(test.cube.aggregateAt(
+	                {MultiDim::Index(1), MultiDim::Index(0)},
+	                sumBy,
+	                test.measure));
+
+	            check() << sum == 3.0 + 4.0;
+            })
+
+        .add_case("index_handling_is_allocation_free_per_cell",
+            []
+            {
+	            TestCube test;
+	            SeriesList dims;
+	            dims.pushBack(test.dim0);
+	            SeriesList sumBy;
+	            sumBy.pushBack(test.dim1);
+
+	            auto cells = 0u;
+	            double sum = 0.0;
+	            size_t ids = 0;
+
+	            allocations allocs;
+
+	            for (auto it = test.cube.getData().begin();
+	                 it != test.cube.getData().end();
+	                 ++it) {
+		            const auto &index = it.getIndex();
+		            ids += test.cube.subSliceID(dims, index);
+		            ids += test.cube.flatSubSliceIndex(dims, index);
+		            ids += test.cube.combinedIndexOf(dims, index);
+		            sum += static_cast<double>(
+		                test.cube.aggregateAt(index, sumBy, test.measure));
+		            cells++;
+	            }
+
+	            auto count = allocs.count();
+	            check() << count == 0u;
+	            check() << cells == 6u;
+	            check() << sum == 2 * (1.0 + 2 + 3 + 4 + 5 + 6);
+	            check() << ids == 15u;
+            })
+
+        .add_case("sub_slice_index_is_restored_from_combined_index",
+            []
+            {
+	            TestCube test;
+	            SeriesList dims;
+	            dims.pushBack(test.dim1);
+	            dims.pushBack(test.dim0);
+
+	            auto mismatches = 0u;
+	            for (auto it = test.cube.getData().begin();
+	                 it != test.cube.getData().end();
+	                 ++it) {
+		            const auto &index = it.getIndex();
+		            auto combined = test.cube.combinedIndexOf(dims, index);
+		            if (test.cube.subSliceIndexOf(dims, combined)
+		                != test.cube.subSliceIndex(dims, index))
+			            mismatches++;
+	            }
+
+	            check() << mismatches == 0u;
+	            check() << test.cube.combinedSizeOf(dims) == 6u;
+            });
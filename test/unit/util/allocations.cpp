@@ -0,0 +1,45 @@
+#include "allocations.h"
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+namespace
+{
+std::atomic<std::size_t> allocation_count{0};
+
+void *counted_alloc(std::size_t size)
+{
+	allocation_count++;
+	if (size == 0) size = 1;
+	if (auto *ptr = std::malloc(size)) return ptr;
+	throw std::bad_alloc();
+}
+}
+
+void *operator new(std::size_t size) { return counted_alloc(size); }
+
+void *operator new[](std::size_t size) { return counted_alloc(size); }
+
+void operator delete(void *ptr) noexcept { std::free(ptr); }
+
+void operator delete[](void *ptr) noexcept { std::free(ptr); }
+
+void operator delete(void *ptr, std::size_t) noexcept { std::free(ptr); }
+
+void operator delete[](void *ptr, std::size_t) noexcept
+{
+	std::free(ptr);
+}
+
+namespace test
+{
+
+allocations::allocations() : start(allocation_count) {}
+
+std::size_t allocations::count() const
+{
+	return allocation_count - start;
+}
+
+}
@@ -0,0 +1,22 @@
+#ifndef TEST_ALLOCATIONS_H
+#define TEST_ALLOCATIONS_H
+
+#include <cstddef>
+
+namespace test
+{
+
+/** Counts the global operator new calls made during its lifetime. */
+class allocations
+{
+public:
+	allocations();
+	std::size_t count() const;
+
+private:
+	std::size_t start;
+};
+
+}
+
+#endif
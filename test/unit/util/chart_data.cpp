@@ -0,0 +1,56 @@
+#include "chart_data.h"
+
+#include <array>
+#include <span>
+#include <string>
+
+#include "chart/main/style.h"
+
+using namespace Vizzu;
+
+namespace test
+{
+
+chart_data::chart_data(std::size_t extraCountries)
+{
+	std::array<const char *, 6> country{"a", "a", "b", "b", "c", "c"};
+	std::array<const char *, 6> region{"x", "x", "x", "x", "y", "y"};
+	std::array<const char *, 6> year{"1", "2", "1", "2", "1", "2"};
+	std::array<double, 6> values{1, 2, 3, 4, 5, 6};
+	table.addColumn("Country", std::span<const char *>(country));
+	table.addColumn("Region", std::span<const char *>(region));
+	table.addColumn("Year", std::span<const char *>(year));
+	table.addColumn("Value", std::span<double>(values));
+
+	for (auto i = 0u; i < extraCountries; i++) {
+		auto name = "additional country " + std::to_string(i);
+		table.pushRow(Data::TableRow<std::string>(
+		    {name, "z", std::to_string(i % 2 + 1), "1"}));
+	}
+}
+
+Gen::PlotOptionsPtr chart_data::options(
+    std::initializer_list<series> channels) const
+{
+	auto res = std::make_shared<Gen::Options>();
+	for (const auto &[channel, column] : channels)
+		res->getChannels().addSeries(channel,
+		    Data::SeriesIndex(column, table));
+	return res;
+}
+
+Gen::PlotPtr chart_data::plot(
+    const Gen::PlotOptionsPtr &options) const
+{
+	return std::make_shared<Gen::Plot>(table,
+	    options,
+	    Styles::Chart::def());
+}
+
+Gen::PlotPtr chart_data::plot(
+    std::initializer_list<series> channels) const
+{
+	return plot(options(channels));
+}
+
+}
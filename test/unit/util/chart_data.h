@@ -0,0 +1,38 @@
+#ifndef TEST_CHART_DATA_H
+#define TEST_CHART_DATA_H
+
+#include <cstddef>
+#include <initializer_list>
+#include <utility>
+
+#include "chart/generator/plot.h"
+#include "data/table/datatable.h"
+
+namespace test
+{
+
+/**
+ * Table of three countries in two regions over two years, optionally
+ * extended with one row per additional country, and plots of it drawn
+ * with the default style.
+ */
+class chart_data
+{
+public:
+	typedef std::pair<Vizzu::Gen::ChannelId, const char *> series;
+
+	Vizzu::Data::DataTable table;
+
+	explicit chart_data(std::size_t extraCountries = 0);
+
+	Vizzu::Gen::PlotOptionsPtr options(
+	    std::initializer_list<series> channels) const;
+	Vizzu::Gen::PlotPtr plot(
+	    const Vizzu::Gen::PlotOptionsPtr &options) const;
+	Vizzu::Gen::PlotPtr plot(
+	    std::initializer_list<series> channels) const;
+};
+
+}
+
+#endif